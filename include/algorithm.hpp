@@ -0,0 +1,1169 @@
+// Random access sorting for ft containers.
+//
+// ft::sort is pattern-defeating quicksort (Orson Peters, "Pattern-defeating
+// Quicksort", 2021): median-of-3 / ninther pivots, BlockQuicksort-style
+// branchless partitioning for arithmetic types under std::less/std::greater,
+// a heapsort fallback once too many partitions come out unbalanced, and
+// sorting networks for the smallest partitions. Already sorted and strictly
+// descending inputs are recognised in one O(n) pass.
+//
+// ft::stable_sort is a bottom-up merge sort over one scratch buffer, falling
+// back to an in-place rotation merge when the buffer cannot be allocated.
+//
+// ft::radix_sort is an LSD radix sort over integer keys, either the elements
+// themselves or a projection such as Point -> 64-bit key;
+// ft::radix_sort_in_place is the MSD American flag sort (McIlroy, Bostic and
+// McIlroy, "Engineering Radix Sort", 1993).
+//
+// ft::find, count, min_element, max_element, mismatch and equal vectorize
+// over contiguous ranges of arithmetic values.
+
+#ifndef FT_ALGORITHM_HPP
+#define FT_ALGORITHM_HPP
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <new>
+#include <limits>
+#include <utility>
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
+#include <cstddef>
+#include "iterators/iterator_traits.hpp"
+#include "iterators/random_access_iterator.hpp"
+#include "iterators/unwrap.hpp"
+#include "utils/simd.hpp"
+
+// Elements are moved where the language allows it and copied otherwise.
+#if __cplusplus >= 201103L
+# define FT_SORT_MOVE(x) std::move(x)
+#else
+# define FT_SORT_MOVE(x) (x)
+#endif
+
+namespace ft {
+
+namespace _detail {
+
+static const std::ptrdiff_t sort_insertion_threshold = 24;
+static const std::ptrdiff_t sort_network_threshold = 8;
+static const std::ptrdiff_t sort_ninther_threshold = 128;
+static const std::ptrdiff_t sort_partial_insertion_limit = 8;
+static const std::size_t    sort_block_size = 64;
+static const std::ptrdiff_t stable_sort_run = 16;
+
+// Partitioning without branches on the comparison only pays off when the
+// comparison is a single cheap instruction.
+template <typename T, typename Compare>
+struct is_branchless_sort { static const bool value = false; };
+
+template <typename T>
+struct is_branchless_sort<T, std::less<T> > {
+  static const bool value = std::numeric_limits<T>::is_specialized;
+};
+
+template <typename T>
+struct is_branchless_sort<T, std::greater<T> > {
+  static const bool value = std::numeric_limits<T>::is_specialized;
+};
+
+template <typename RandomIt, typename Compare>
+void insertion_sort(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  if (first == last)
+    return;
+  for (RandomIt cur = first + 1; cur != last; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = FT_SORT_MOVE(*sift);
+      do {
+        *sift-- = FT_SORT_MOVE(*sift_1);
+      } while (sift != first && comp(tmp, *--sift_1));
+      *sift = FT_SORT_MOVE(tmp);
+    }
+  }
+}
+
+// Requires *(first - 1) to compare no greater than any element in range.
+template <typename RandomIt, typename Compare>
+void unguarded_insertion_sort(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  if (first == last)
+    return;
+  for (RandomIt cur = first + 1; cur != last; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = FT_SORT_MOVE(*sift);
+      do {
+        *sift-- = FT_SORT_MOVE(*sift_1);
+      } while (comp(tmp, *--sift_1));
+      *sift = FT_SORT_MOVE(tmp);
+    }
+  }
+}
+
+// Insertion sort that gives up after moving a handful of elements; returns
+// whether the range ended up sorted.
+template <typename RandomIt, typename Compare>
+bool partial_insertion_sort(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  if (first == last)
+    return true;
+  std::ptrdiff_t moved = 0;
+  for (RandomIt cur = first + 1; cur != last; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = FT_SORT_MOVE(*sift);
+      do {
+        *sift-- = FT_SORT_MOVE(*sift_1);
+      } while (sift != first && comp(tmp, *--sift_1));
+      *sift = FT_SORT_MOVE(tmp);
+      moved += cur - sift;
+      if (moved > sort_partial_insertion_limit)
+        return false;
+    }
+  }
+  return true;
+}
+
+template <bool Branchless>
+struct compare_exchange {
+  template <typename RandomIt, typename Compare>
+  static void apply(RandomIt a, RandomIt b, Compare comp) {
+    if (comp(*b, *a))
+      std::iter_swap(a, b);
+  }
+};
+
+// Selects instead of branching, so the compiler can emit conditional moves.
+template <>
+struct compare_exchange<true> {
+  template <typename RandomIt, typename Compare>
+  static void apply(RandomIt a, RandomIt b, Compare comp) {
+    typedef typename ft::iterator_traits<RandomIt>::value_type T;
+    T x = *a;
+    T y = *b;
+    bool swapped = comp(y, x);
+    *a = swapped ? y : x;
+    *b = swapped ? x : y;
+  }
+};
+
+// Size-optimal networks for 2 to 8 elements, as comparator index pairs.
+template <bool Branchless, typename RandomIt, typename Compare>
+void sorting_network(RandomIt first, std::ptrdiff_t n, Compare comp) {
+  static const unsigned char net2[][2] = { {0,1} };
+  static const unsigned char net3[][2] = { {0,2}, {0,1}, {1,2} };
+  static const unsigned char net4[][2] = { {0,2}, {1,3}, {0,1}, {2,3}, {1,2} };
+  static const unsigned char net5[][2] = {
+    {0,3}, {1,4}, {0,2}, {1,3}, {0,1}, {2,4}, {1,2}, {3,4}, {2,3} };
+  static const unsigned char net6[][2] = {
+    {0,5}, {1,3}, {2,4}, {1,2}, {3,4}, {0,3}, {2,5}, {0,1}, {2,3}, {4,5}, {1,2}, {3,4} };
+  static const unsigned char net7[][2] = {
+    {0,6}, {2,3}, {4,5}, {0,2}, {1,4}, {3,6}, {0,1}, {2,5}, {3,4}, {1,2}, {4,6}, {2,3},
+    {4,5}, {1,2}, {3,4}, {5,6} };
+  static const unsigned char net8[][2] = {
+    {0,2}, {1,3}, {4,6}, {5,7}, {0,4}, {1,5}, {2,6}, {3,7}, {0,1}, {2,3}, {4,5}, {6,7},
+    {2,4}, {3,5}, {1,4}, {3,6}, {1,2}, {3,4}, {5,6} };
+  static const unsigned char (*const nets[])[2] = { 0, 0, net2, net3, net4, net5, net6, net7, net8 };
+  static const std::size_t sizes[] = {
+    0, 0, sizeof(net2) / 2, sizeof(net3) / 2, sizeof(net4) / 2, sizeof(net5) / 2,
+    sizeof(net6) / 2, sizeof(net7) / 2, sizeof(net8) / 2 };
+
+  const unsigned char (*net)[2] = nets[n];
+  for (std::size_t i = 0; i < sizes[n]; ++i)
+    compare_exchange<Branchless>::apply(first + net[i][0], first + net[i][1], comp);
+}
+
+template <typename RandomIt, typename Compare>
+void sort3(RandomIt a, RandomIt b, RandomIt c, Compare comp) {
+  compare_exchange<false>::apply(a, b, comp);
+  compare_exchange<false>::apply(b, c, comp);
+  compare_exchange<false>::apply(a, b, comp);
+}
+
+template <typename RandomIt, typename Compare>
+void sift_down(RandomIt first, std::ptrdiff_t root, std::ptrdiff_t n, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  T value = FT_SORT_MOVE(first[root]);
+  std::ptrdiff_t child;
+  while ((child = 2 * root + 1) < n) {
+    if (child + 1 < n && comp(first[child], first[child + 1]))
+      ++child;
+    if (!comp(value, first[child]))
+      break;
+    first[root] = FT_SORT_MOVE(first[child]);
+    root = child;
+  }
+  first[root] = FT_SORT_MOVE(value);
+}
+
+template <typename RandomIt, typename Compare>
+void heap_sort(RandomIt first, RandomIt last, Compare comp) {
+  std::ptrdiff_t n = last - first;
+  for (std::ptrdiff_t i = n / 2; i-- > 0;)
+    sift_down(first, i, n, comp);
+  while (n > 1) {
+    --n;
+    std::iter_swap(first, first + n);
+    sift_down(first, 0, n, comp);
+  }
+}
+
+// Partitions [first, last) around the pivot *first. Elements equal to the
+// pivot go right. Returns the pivot's final position and whether the range
+// was already partitioned.
+template <typename RandomIt, typename Compare>
+std::pair<RandomIt, bool> partition_right(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  T pivot = FT_SORT_MOVE(*first);
+  RandomIt lo = first;
+  RandomIt hi = last;
+
+  // The median-of-3 guarantees an element >= pivot exists
+  while (comp(*++lo, pivot)) {}
+  if (lo - 1 == first)
+    while (lo < hi && !comp(*--hi, pivot)) {}
+  else
+    while (!comp(*--hi, pivot)) {}
+
+  bool already_partitioned = lo >= hi;
+  while (lo < hi) {
+    std::iter_swap(lo, hi);
+    while (comp(*++lo, pivot)) {}
+    while (!comp(*--hi, pivot)) {}
+  }
+
+  RandomIt pivot_pos = lo - 1;
+  *first = FT_SORT_MOVE(*pivot_pos);
+  *pivot_pos = FT_SORT_MOVE(pivot);
+  return std::make_pair(pivot_pos, already_partitioned);
+}
+
+// Swaps num misplaced pairs recorded as offsets from lo_base and hi_base.
+// A cyclic permutation needs fewer moves, but equal-sized blocks use plain
+// swaps so descending input stays linear.
+template <typename RandomIt>
+void swap_offsets(RandomIt lo_base, RandomIt hi_base, const unsigned char* offsets_l,
+                  const unsigned char* offsets_r, std::size_t num, bool use_swaps) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  if (use_swaps) {
+    for (std::size_t i = 0; i < num; ++i)
+      std::iter_swap(lo_base + offsets_l[i], hi_base - offsets_r[i]);
+  } else if (num > 0) {
+    RandomIt l = lo_base + offsets_l[0];
+    RandomIt r = hi_base - offsets_r[0];
+    T tmp = FT_SORT_MOVE(*l);
+    *l = FT_SORT_MOVE(*r);
+    for (std::size_t i = 1; i < num; ++i) {
+      l = lo_base + offsets_l[i];
+      *r = FT_SORT_MOVE(*l);
+      r = hi_base - offsets_r[i];
+      *l = FT_SORT_MOVE(*r);
+    }
+    *r = FT_SORT_MOVE(tmp);
+  }
+}
+
+// partition_right with BlockQuicksort (Edelkamp and Weiss, 2016): the
+// comparison results of a block of elements are recorded as offsets with
+// no data-dependent branch, then the misplaced elements are swapped.
+template <typename RandomIt, typename Compare>
+std::pair<RandomIt, bool> partition_right_branchless(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  T pivot = FT_SORT_MOVE(*first);
+  RandomIt lo = first;
+  RandomIt hi = last;
+
+  while (comp(*++lo, pivot)) {}
+  if (lo - 1 == first)
+    while (lo < hi && !comp(*--hi, pivot)) {}
+  else
+    while (!comp(*--hi, pivot)) {}
+
+  bool already_partitioned = lo >= hi;
+  if (!already_partitioned) {
+    std::iter_swap(lo, hi);
+    ++lo;
+
+    unsigned char offsets_l[sort_block_size];
+    unsigned char offsets_r[sort_block_size];
+    RandomIt lo_base = lo;
+    RandomIt hi_base = hi;
+    std::size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+    while (lo < hi) {
+      // Refill whichever offset block is empty; split the unknown middle
+      // evenly when both are.
+      std::size_t num_unknown = hi - lo;
+      std::size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+      std::size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+      if (left_split > sort_block_size)
+        left_split = sort_block_size;
+      if (right_split > sort_block_size)
+        right_split = sort_block_size;
+
+      for (std::size_t i = 0; i < left_split; ++i) {
+        offsets_l[num_l] = static_cast<unsigned char>(i);
+        num_l += !comp(*lo, pivot);
+        ++lo;
+      }
+      for (std::size_t i = 0; i < right_split; ++i) {
+        offsets_r[num_r] = static_cast<unsigned char>(i + 1);
+        num_r += comp(*--hi, pivot);
+      }
+
+      std::size_t num = std::min(num_l, num_r);
+      swap_offsets(lo_base, hi_base, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+      num_l -= num;
+      num_r -= num;
+      start_l += num;
+      start_r += num;
+      if (num_l == 0) {
+        start_l = 0;
+        lo_base = lo;
+      }
+      if (num_r == 0) {
+        start_r = 0;
+        hi_base = hi;
+      }
+    }
+
+    // One block may still hold misplaced elements; move them to the
+    // boundary.
+    if (num_l) {
+      const unsigned char* offsets = offsets_l + start_l;
+      while (num_l--)
+        std::iter_swap(lo_base + offsets[num_l], --hi);
+      lo = hi;
+    }
+    if (num_r) {
+      const unsigned char* offsets = offsets_r + start_r;
+      while (num_r--) {
+        std::iter_swap(hi_base - offsets[num_r], lo);
+        ++lo;
+      }
+    }
+  }
+
+  RandomIt pivot_pos = lo - 1;
+  *first = FT_SORT_MOVE(*pivot_pos);
+  *pivot_pos = FT_SORT_MOVE(pivot);
+  return std::make_pair(pivot_pos, already_partitioned);
+}
+
+// Partitions with elements equal to the pivot going left. Used when the
+// pivot equals the element before the range, i.e. a run of duplicates.
+template <typename RandomIt, typename Compare>
+RandomIt partition_left(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  T pivot = FT_SORT_MOVE(*first);
+  RandomIt lo = first;
+  RandomIt hi = last;
+
+  while (comp(pivot, *--hi)) {}
+  if (hi + 1 == last)
+    while (lo < hi && !comp(pivot, *++lo)) {}
+  else
+    while (!comp(pivot, *++lo)) {}
+
+  while (lo < hi) {
+    std::iter_swap(lo, hi);
+    while (comp(pivot, *--hi)) {}
+    while (!comp(pivot, *++lo)) {}
+  }
+
+  *first = FT_SORT_MOVE(*hi);
+  *hi = FT_SORT_MOVE(pivot);
+  return hi;
+}
+
+template <bool Branchless, typename RandomIt, typename Compare>
+void pdq_sort_loop(RandomIt first, RandomIt last, Compare comp, int bad_allowed, bool leftmost) {
+  typedef typename ft::iterator_traits<RandomIt>::difference_type diff_t;
+
+  while (true) {
+    diff_t size = last - first;
+    if (size <= sort_network_threshold) {
+      if (size > 1)
+        sorting_network<Branchless>(first, size, comp);
+      return;
+    }
+    if (size < sort_insertion_threshold) {
+      if (leftmost)
+        insertion_sort(first, last, comp);
+      else
+        unguarded_insertion_sort(first, last, comp);
+      return;
+    }
+
+    // Median of 3, or Tukey's ninther on larger ranges; the pivot ends up
+    // in *first.
+    diff_t s2 = size / 2;
+    if (size > sort_ninther_threshold) {
+      sort3(first, first + s2, last - 1, comp);
+      sort3(first + 1, first + (s2 - 1), last - 2, comp);
+      sort3(first + 2, first + (s2 + 1), last - 3, comp);
+      sort3(first + (s2 - 1), first + s2, first + (s2 + 1), comp);
+      std::iter_swap(first, first + s2);
+    } else {
+      sort3(first + s2, first, last - 1, comp);
+    }
+
+    // Pivot equal to the left neighbour: everything equal to it is in its
+    // final place once partitioned left.
+    if (!leftmost && !comp(*(first - 1), *first)) {
+      first = partition_left(first, last, comp) + 1;
+      continue;
+    }
+
+    std::pair<RandomIt, bool> part = Branchless
+      ? partition_right_branchless(first, last, comp)
+      : partition_right(first, last, comp);
+    RandomIt pivot_pos = part.first;
+    diff_t l_size = pivot_pos - first;
+    diff_t r_size = last - (pivot_pos + 1);
+
+    if (l_size < size / 8 || r_size < size / 8) {
+      // Unbalanced: give up on quicksort after log2(n) of these, otherwise
+      // shuffle some elements to break the pattern.
+      if (--bad_allowed == 0) {
+        heap_sort(first, last, comp);
+        return;
+      }
+      if (l_size >= sort_insertion_threshold) {
+        std::iter_swap(first, first + l_size / 4);
+        std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+        if (l_size > sort_ninther_threshold) {
+          std::iter_swap(first + 1, first + (l_size / 4 + 1));
+          std::iter_swap(first + 2, first + (l_size / 4 + 2));
+          std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+          std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+      }
+      if (r_size >= sort_insertion_threshold) {
+        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        std::iter_swap(last - 1, last - r_size / 4);
+        if (r_size > sort_ninther_threshold) {
+          std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+          std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+          std::iter_swap(last - 2, last - (1 + r_size / 4));
+          std::iter_swap(last - 3, last - (2 + r_size / 4));
+        }
+      }
+    } else if (part.second && partial_insertion_sort(first, pivot_pos, comp)
+               && partial_insertion_sort(pivot_pos + 1, last, comp)) {
+      // No swaps during partitioning and both sides nearly sorted
+      return;
+    }
+
+    // Recurse into the left side, loop on the right
+    pdq_sort_loop<Branchless>(first, pivot_pos, comp, bad_allowed, leftmost);
+    first = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+// Returns the end of the non-descending prefix of [first, last). If the
+// range opens strictly descending, that run is reversed in place first, so
+// a fully reversed input comes back sorted.
+template <typename RandomIt, typename Compare>
+RandomIt sorted_prefix(RandomIt first, RandomIt last, Compare comp) {
+  if (last - first < 2)
+    return last;
+  RandomIt it = first + 1;
+  if (comp(*it, *first)) {
+    while (it != last && comp(*it, *(it - 1)))
+      ++it;
+    std::reverse(first, it);
+    if (it == last)
+      return last;
+  }
+  while (it != last && !comp(*it, *(it - 1)))
+    ++it;
+  return it;
+}
+
+template <typename RandomIt, typename Compare>
+void merge_into(RandomIt first, RandomIt mid, RandomIt last,
+                typename ft::iterator_traits<RandomIt>::value_type* out, Compare comp) {
+  RandomIt a = first;
+  RandomIt b = mid;
+  while (a != mid && b != last) {
+    if (comp(*b, *a))
+      *out++ = FT_SORT_MOVE(*b++);
+    else
+      *out++ = FT_SORT_MOVE(*a++);
+  }
+  while (a != mid)
+    *out++ = FT_SORT_MOVE(*a++);
+  while (b != last)
+    *out++ = FT_SORT_MOVE(*b++);
+}
+
+template <typename T, typename RandomIt, typename Compare>
+void merge_from(T* first, T* mid, T* last, RandomIt out, Compare comp) {
+  T* a = first;
+  T* b = mid;
+  while (a != mid && b != last) {
+    if (comp(*b, *a))
+      *out++ = FT_SORT_MOVE(*b++);
+    else
+      *out++ = FT_SORT_MOVE(*a++);
+  }
+  while (a != mid)
+    *out++ = FT_SORT_MOVE(*a++);
+  while (b != last)
+    *out++ = FT_SORT_MOVE(*b++);
+}
+
+// Stable in-place merge by rotation, for when no buffer is available.
+template <typename RandomIt, typename Compare>
+void merge_in_place(RandomIt first, RandomIt mid, RandomIt last, Compare comp) {
+  std::ptrdiff_t n1 = mid - first;
+  std::ptrdiff_t n2 = last - mid;
+  if (n1 == 0 || n2 == 0)
+    return;
+  if (n1 + n2 == 2) {
+    if (comp(*mid, *first))
+      std::iter_swap(first, mid);
+    return;
+  }
+  RandomIt cut1, cut2;
+  if (n1 > n2) {
+    cut1 = first + n1 / 2;
+    cut2 = std::lower_bound(mid, last, *cut1, comp);
+  } else {
+    cut2 = mid + n2 / 2;
+    cut1 = std::upper_bound(first, mid, *cut2, comp);
+  }
+  std::rotate(cut1, mid, cut2);
+  RandomIt new_mid = cut1 + (cut2 - mid);
+  merge_in_place(first, cut1, new_mid, comp);
+  merge_in_place(new_mid, cut2, last, comp);
+}
+
+template <typename RandomIt, typename Compare>
+void stable_sort_in_place(RandomIt first, RandomIt last, Compare comp) {
+  std::ptrdiff_t n = last - first;
+  for (std::ptrdiff_t i = 0; i < n; i += stable_sort_run)
+    insertion_sort(first + i, first + std::min(i + stable_sort_run, n), comp);
+  for (std::ptrdiff_t width = stable_sort_run; width < n; width *= 2)
+    for (std::ptrdiff_t i = 0; i + width < n; i += 2 * width)
+      merge_in_place(first + i, first + i + width, first + std::min(i + 2 * width, n), comp);
+}
+
+// First merge pass of the buffered stable sort: merges neighbouring runs of
+// the range straight into raw storage, so buf is never filled with copies
+// that would only be overwritten. built counts constructed elements.
+template <typename RandomIt, typename T, typename Alloc, typename Compare>
+void merge_construct(RandomIt first, RandomIt last, T* buf, std::ptrdiff_t width,
+                     Alloc& alloc, std::ptrdiff_t& built, Compare comp) {
+  std::ptrdiff_t n = last - first;
+  for (std::ptrdiff_t i = 0; i < n; i += 2 * width) {
+    RandomIt a = first + i;
+    RandomIt mid = first + std::min(i + width, n);
+    RandomIt b = mid;
+    RandomIt end = first + std::min(i + 2 * width, n);
+    while (a != mid && b != end) {
+      if (comp(*b, *a))
+        alloc.construct(buf + built, FT_SORT_MOVE(*b++));
+      else
+        alloc.construct(buf + built, FT_SORT_MOVE(*a++));
+      ++built;
+    }
+    for (; a != mid; ++built)
+      alloc.construct(buf + built, FT_SORT_MOVE(*a++));
+    for (; b != end; ++built)
+      alloc.construct(buf + built, FT_SORT_MOVE(*b++));
+  }
+}
+
+// Remaining passes of the bottom-up merge sort. The data starts in buf as
+// sorted runs of width; passes alternate direction and end in the range.
+template <typename RandomIt, typename T, typename Compare>
+void merge_passes(RandomIt first, RandomIt last, T* buf, std::ptrdiff_t width, Compare comp) {
+  std::ptrdiff_t n = last - first;
+  while (true) {
+    for (std::ptrdiff_t i = 0; i < n; i += 2 * width) {
+      std::ptrdiff_t mid = std::min(i + width, n);
+      std::ptrdiff_t end = std::min(i + 2 * width, n);
+      merge_from(buf + i, buf + mid, buf + end, first + i, comp);
+    }
+    width *= 2;
+    if (width >= n)
+      return;
+    for (std::ptrdiff_t i = 0; i < n; i += 2 * width) {
+      std::ptrdiff_t mid = std::min(i + width, n);
+      std::ptrdiff_t end = std::min(i + 2 * width, n);
+      merge_into(first + i, first + mid, first + end, buf + i, comp);
+    }
+    width *= 2;
+  }
+}
+
+} // namespace _detail
+
+template <typename RandomIt, typename Compare>
+void sort(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  if (_detail::sorted_prefix(first, last, comp) == last)
+    return;
+  int bad_allowed = 0;
+  for (std::ptrdiff_t n = last - first; n > 0; n >>= 1)
+    ++bad_allowed;
+  _detail::pdq_sort_loop<_detail::is_branchless_sort<T, Compare>::value>(
+    first, last, comp, bad_allowed, true);
+}
+
+template <typename RandomIt>
+void sort(RandomIt first, RandomIt last) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  ft::sort(first, last, std::less<T>());
+}
+
+template <typename RandomIt, typename Compare>
+void stable_sort(RandomIt first, RandomIt last, Compare comp) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  std::ptrdiff_t n = last - first;
+  if (n < 2)
+    return;
+  // Only a strictly descending run may be reversed without breaking
+  // stability, which is exactly what sorted_prefix reverses.
+  if (_detail::sorted_prefix(first, last, comp) == last)
+    return;
+  if (n <= _detail::stable_sort_run) {
+    _detail::insertion_sort(first, last, comp);
+    return;
+  }
+
+  std::allocator<T> alloc;
+  T* buf = 0;
+  try {
+    buf = alloc.allocate(n);
+  } catch (const std::bad_alloc&) {
+    _detail::stable_sort_in_place(first, last, comp);
+    return;
+  }
+  std::ptrdiff_t built = 0;
+  try {
+    for (std::ptrdiff_t i = 0; i < n; i += _detail::stable_sort_run)
+      _detail::insertion_sort(first + i, first + std::min(i + _detail::stable_sort_run, n), comp);
+    _detail::merge_construct(first, last, buf, _detail::stable_sort_run, alloc, built, comp);
+    _detail::merge_passes(first, last, buf, 2 * _detail::stable_sort_run, comp);
+  } catch (...) {
+    for (std::ptrdiff_t i = 0; i < built; ++i)
+      alloc.destroy(buf + i);
+    alloc.deallocate(buf, n);
+    throw;
+  }
+  for (std::ptrdiff_t i = 0; i < n; ++i)
+    alloc.destroy(buf + i);
+  alloc.deallocate(buf, n);
+}
+
+template <typename RandomIt>
+void stable_sort(RandomIt first, RandomIt last) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  ft::stable_sort(first, last, std::less<T>());
+}
+
+namespace _detail {
+
+static const std::ptrdiff_t radix_sort_threshold = 256;
+static const std::ptrdiff_t radix_prefetch_distance = 16;
+
+// Maps an integer key to an unsigned key with the same ordering: signed
+// keys get their sign bit flipped.
+template <typename K, typename U>
+struct radix_key_base {
+  typedef U unsigned_type;
+  static U encode(K k) {
+    if (std::numeric_limits<K>::is_signed)
+      return static_cast<U>(static_cast<U>(k) ^ (U(1) << (sizeof(U) * 8 - 1)));
+    return static_cast<U>(k);
+  }
+};
+
+template <typename K>
+struct radix_key;
+
+template <> struct radix_key<char> : radix_key_base<char, unsigned char> {};
+template <> struct radix_key<signed char> : radix_key_base<signed char, unsigned char> {};
+template <> struct radix_key<unsigned char> : radix_key_base<unsigned char, unsigned char> {};
+template <> struct radix_key<short> : radix_key_base<short, unsigned short> {};
+template <> struct radix_key<unsigned short> : radix_key_base<unsigned short, unsigned short> {};
+template <> struct radix_key<int> : radix_key_base<int, unsigned int> {};
+template <> struct radix_key<unsigned int> : radix_key_base<unsigned int, unsigned int> {};
+template <> struct radix_key<long> : radix_key_base<long, unsigned long> {};
+template <> struct radix_key<unsigned long> : radix_key_base<unsigned long, unsigned long> {};
+template <> struct radix_key<long long> : radix_key_base<long long, unsigned long long> {};
+template <> struct radix_key<unsigned long long> : radix_key_base<unsigned long long, unsigned long long> {};
+
+// Result type of a key extractor: result_type in C++98 (std::unary_function
+// style functors and function pointers), deduced in C++11.
+#if __cplusplus >= 201103L
+template <typename KeyFn, typename Arg>
+struct key_result {
+  typedef typename std::decay<decltype(std::declval<KeyFn&>()(std::declval<const Arg&>()))>::type type;
+};
+#else
+template <typename KeyFn, typename Arg>
+struct key_result { typedef typename KeyFn::result_type type; };
+
+template <typename R, typename A, typename Arg>
+struct key_result<R (*)(A), Arg> { typedef R type; };
+#endif
+
+template <typename T>
+struct identity_key {
+  typedef T result_type;
+  const T& operator()(const T& v) const { return v; }
+};
+
+// Encodes each element's key once per use; key extractors are expected to
+// be cheap projections.
+template <typename T, typename KeyFn>
+struct radix_encoder {
+  typedef typename key_result<KeyFn, T>::type key_type;
+  typedef radix_key<key_type>                 traits;
+  typedef typename traits::unsigned_type      unsigned_type;
+
+  KeyFn key;
+  explicit radix_encoder(KeyFn k) : key(k) {}
+
+  unsigned_type operator()(const T& v) const { return traits::encode(key(v)); }
+  std::size_t digit(const T& v, unsigned shift) const {
+    return static_cast<std::size_t>((operator()(v) >> shift) & 0xFF);
+  }
+  bool operator()(const T& a, const T& b) const { return operator()(a) < operator()(b); }
+};
+
+// One LSD pass: stable scatter of src into dst by the digit at shift.
+// The slot the element radix_prefetch_distance ahead will land in is
+// prefetched, since the 256 write streams defeat the hardware prefetcher.
+template <typename SrcIt, typename DstIt, typename Encoder>
+void radix_scatter(SrcIt src, std::ptrdiff_t n, DstIt dst, const std::size_t* count,
+                   unsigned shift, const Encoder& enc) {
+  std::ptrdiff_t offset[256];
+  std::ptrdiff_t sum = 0;
+  for (std::size_t d = 0; d < 256; ++d) {
+    offset[d] = sum;
+    sum += count[d];
+  }
+  std::ptrdiff_t i = 0;
+#if defined(__GNUC__)
+  for (; i + radix_prefetch_distance < n; ++i) {
+    __builtin_prefetch(&*(dst + offset[enc.digit(src[i + radix_prefetch_distance], shift)]), 1);
+    dst[offset[enc.digit(src[i], shift)]++] = FT_SORT_MOVE(src[i]);
+  }
+#endif
+  for (; i < n; ++i)
+    dst[offset[enc.digit(src[i], shift)]++] = FT_SORT_MOVE(src[i]);
+}
+
+// American flag sort: in-place MSD radix sort. Each level counts one digit,
+// cycles elements into their buckets by swapping, then recurses into each
+// bucket; buckets below radix_sort_threshold go to ft::sort.
+template <typename RandomIt, typename Encoder>
+void american_flag_sort(RandomIt first, RandomIt last, int shift, const Encoder& enc) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  while (true) {
+    std::ptrdiff_t n = last - first;
+    if (n < radix_sort_threshold) {
+      ft::sort(first, last, enc);
+      return;
+    }
+
+    std::ptrdiff_t count[256] = { 0 };
+    for (RandomIt it = first; it != last; ++it)
+      ++count[enc.digit(*it, shift)];
+
+    // Constant digit: nothing to permute at this level
+    if (count[enc.digit(*first, shift)] == n) {
+      if (shift == 0)
+        return;
+      shift -= 8;
+      continue;
+    }
+
+    std::ptrdiff_t next[256];
+    std::ptrdiff_t end[256];
+    std::ptrdiff_t sum = 0;
+    for (std::size_t d = 0; d < 256; ++d) {
+      next[d] = sum;
+      sum += count[d];
+      end[d] = sum;
+    }
+
+    for (std::size_t b = 0; b < 256; ++b) {
+      while (next[b] < end[b]) {
+        T v = FT_SORT_MOVE(first[next[b]]);
+        std::size_t d = enc.digit(v, shift);
+        while (d != b) {
+          std::swap(v, first[next[d]++]);
+          d = enc.digit(v, shift);
+        }
+        first[next[b]++] = FT_SORT_MOVE(v);
+      }
+    }
+
+    if (shift == 0)
+      return;
+    std::ptrdiff_t start = 0;
+    for (std::size_t b = 0; b < 256; ++b) {
+      if (count[b] > 1)
+        american_flag_sort(first + start, first + start + count[b], shift - 8, enc);
+      start += count[b];
+    }
+    return;
+  }
+}
+
+} // namespace _detail
+
+// LSD radix sort on 8-bit digits. key maps an element to an integer key
+// (signed or unsigned, up to 64 bits); elements with equal keys keep their
+// order. All digit histograms come from one read pass, and passes whose
+// digit is the same for every element are skipped. Uses a scratch copy of
+// the range.
+template <typename RandomIt, typename KeyFn>
+void radix_sort(RandomIt first, RandomIt last, KeyFn key) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  typedef _detail::radix_encoder<T, KeyFn>                     encoder;
+  typedef typename encoder::unsigned_type                      U;
+  static const std::size_t passes = sizeof(U);
+
+  std::ptrdiff_t n = last - first;
+  encoder enc(key);
+  if (n < _detail::radix_sort_threshold) {
+    ft::stable_sort(first, last, enc);
+    return;
+  }
+
+  std::size_t count[passes][256];
+  for (std::size_t p = 0; p < passes; ++p)
+    for (std::size_t d = 0; d < 256; ++d)
+      count[p][d] = 0;
+  for (RandomIt it = first; it != last; ++it) {
+    U k = enc(*it);
+    for (std::size_t p = 0; p < passes; ++p)
+      ++count[p][(k >> (8 * p)) & 0xFF];
+  }
+
+  std::allocator<T> alloc;
+  T* buf = alloc.allocate(n);
+  std::ptrdiff_t built = 0;
+  try {
+    for (; built < n; ++built)
+      alloc.construct(buf + built, first[built]);
+
+    bool in_buf = false;
+    U sample = enc(*first);
+    for (std::size_t p = 0; p < passes; ++p) {
+      if (count[p][(sample >> (8 * p)) & 0xFF] == static_cast<std::size_t>(n))
+        continue;
+      if (in_buf)
+        _detail::radix_scatter(buf, n, first, count[p], 8 * p, enc);
+      else
+        _detail::radix_scatter(first, n, buf, count[p], 8 * p, enc);
+      in_buf = !in_buf;
+    }
+    if (in_buf)
+      for (std::ptrdiff_t i = 0; i < n; ++i)
+        first[i] = FT_SORT_MOVE(buf[i]);
+  } catch (...) {
+    for (std::ptrdiff_t i = 0; i < built; ++i)
+      alloc.destroy(buf + i);
+    alloc.deallocate(buf, n);
+    throw;
+  }
+  for (std::ptrdiff_t i = 0; i < n; ++i)
+    alloc.destroy(buf + i);
+  alloc.deallocate(buf, n);
+}
+
+template <typename RandomIt>
+void radix_sort(RandomIt first, RandomIt last) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  ft::radix_sort(first, last, _detail::identity_key<T>());
+}
+
+// In-place MSD variant (American flag sort): no scratch buffer, but not
+// stable.
+template <typename RandomIt, typename KeyFn>
+void radix_sort_in_place(RandomIt first, RandomIt last, KeyFn key) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  typedef _detail::radix_encoder<T, KeyFn>                     encoder;
+  if (last - first < 2)
+    return;
+  _detail::american_flag_sort(first, last, 8 * (sizeof(typename encoder::unsigned_type) - 1),
+                              encoder(key));
+}
+
+template <typename RandomIt>
+void radix_sort_in_place(RandomIt first, RandomIt last) {
+  typedef typename ft::iterator_traits<RandomIt>::value_type T;
+  ft::radix_sort_in_place(first, last, _detail::identity_key<T>());
+}
+
+namespace _detail {
+
+template <typename T> struct remove_const { typedef T type; };
+template <typename T> struct remove_const<const T> { typedef T type; };
+
+template <typename A, typename B> struct is_same { static const bool value = false; };
+template <typename A> struct is_same<A, A> { static const bool value = true; };
+
+template <bool B> struct bool_tag {};
+
+// Iterators over contiguous storage, which the SIMD kernels read through
+// raw pointers.
+template <typename It>
+struct contiguous {
+  static const bool value = iterator_unwrapper<It>::contiguous;
+  static typename iterator_unwrapper<It>::type address(const It& it) { return ft::unwrap(it); }
+};
+
+// Kernel eligibility: contiguous, a vectorizable element type, and a
+// searched value of exactly that type (a converted value could change what
+// compares equal).
+template <typename It, typename T = typename ft::iterator_traits<It>::value_type>
+struct simd_range {
+  typedef typename remove_const<typename ft::iterator_traits<It>::value_type>::type value_type;
+  static const bool value = contiguous<It>::value
+    && is_same<value_type, typename remove_const<T>::type>::value
+    && _simd::lane<value_type>::kind != _simd::LANE_NONE;
+  static const bool minmax = contiguous<It>::value && _simd::minmax_lane<value_type>::supported;
+};
+
+template <typename InputIt, typename T>
+InputIt find(InputIt first, InputIt last, const T& value, bool_tag<false>) {
+  for (; first != last; ++first)
+    if (*first == value)
+      return first;
+  return last;
+}
+
+template <typename It, typename T>
+It find(It first, It last, const T& value, bool_tag<true>) {
+  const T* base = contiguous<It>::address(first);
+  const T* end = base + (last - first);
+  return first + (_simd::find(base, end, value) - base);
+}
+
+template <typename InputIt, typename T>
+typename ft::iterator_traits<InputIt>::difference_type
+count(InputIt first, InputIt last, const T& value, bool_tag<false>) {
+  typename ft::iterator_traits<InputIt>::difference_type n = 0;
+  for (; first != last; ++first)
+    if (*first == value)
+      ++n;
+  return n;
+}
+
+template <typename It, typename T>
+typename ft::iterator_traits<It>::difference_type
+count(It first, It last, const T& value, bool_tag<true>) {
+  const T* base = contiguous<It>::address(first);
+  return _simd::count(base, base + (last - first), value);
+}
+
+template <bool Max, typename ForwardIt>
+ForwardIt extreme_element(ForwardIt first, ForwardIt last, bool_tag<false>) {
+  if (first == last)
+    return last;
+  ForwardIt best = first;
+  for (++first; first != last; ++first)
+    if (Max ? *best < *first : *first < *best)
+      best = first;
+  return best;
+}
+
+template <bool Max, typename It>
+It extreme_element(It first, It last, bool_tag<true>) {
+  if (first == last)
+    return last;
+  typedef typename simd_range<It>::value_type T;
+  const T* base = contiguous<It>::address(first);
+  return first + (_simd::extreme_element<Max>(base, base + (last - first)) - base);
+}
+
+template <typename InputIt1, typename InputIt2>
+std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, bool_tag<false>) {
+  while (first1 != last1 && *first1 == *first2) {
+    ++first1;
+    ++first2;
+  }
+  return std::make_pair(first1, first2);
+}
+
+template <typename It1, typename It2>
+std::pair<It1, It2> mismatch(It1 first1, It1 last1, It2 first2, bool_tag<true>) {
+  typedef typename simd_range<It1>::value_type T;
+  const T* a = contiguous<It1>::address(first1);
+  const T* b = contiguous<It2>::address(first2);
+  std::size_t i = _simd::mismatch(a, b, last1 - first1);
+  return std::make_pair(first1 + i, first2 + i);
+}
+
+template <typename InputIt1, typename InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, bool_tag<false>) {
+  for (; first1 != last1; ++first1, ++first2)
+    if (!(*first1 == *first2))
+      return false;
+  return true;
+}
+
+template <typename It1, typename It2>
+bool equal(It1 first1, It1 last1, It2 first2, bool_tag<true>) {
+  typedef typename simd_range<It1>::value_type T;
+  return _simd::equal<T>(contiguous<It1>::address(first1), contiguous<It2>::address(first2),
+                         last1 - first1);
+}
+
+template <typename It1, typename It2>
+bool lexicographical_compare(It1 first1, It1 last1, It2 first2, It2 last2, bool_tag<false>) {
+  return std::lexicographical_compare(ft::unwrap(first1), ft::unwrap(last1),
+                                      ft::unwrap(first2), ft::unwrap(last2));
+}
+
+template <typename It1, typename It2>
+bool lexicographical_compare(It1 first1, It1 last1, It2 first2, It2 last2, bool_tag<true>) {
+  typedef typename simd_range<It1>::value_type T;
+  return _simd::dispatch<T>::less(contiguous<It1>::address(first1), last1 - first1,
+                                  contiguous<It2>::address(first2), last2 - first2);
+}
+
+} // namespace _detail
+
+// Copies, fills and comparisons that unwrap ft::vector iterators (and
+// reverse iterators over them) to raw pointers before handing the range to
+// the standard algorithm, so trivially copyable elements are moved with
+// memmove and bytes filled with memset, as for a std::vector.
+
+template <typename InputIt, typename OutputIt>
+OutputIt copy(InputIt first, InputIt last, OutputIt d_first) {
+  return ft::rewrap(d_first, std::copy(ft::unwrap(first), ft::unwrap(last), ft::unwrap(d_first)));
+}
+
+template <typename BidirIt1, typename BidirIt2>
+BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last) {
+  return ft::rewrap(d_last, std::copy_backward(ft::unwrap(first), ft::unwrap(last),
+                                               ft::unwrap(d_last)));
+}
+
+template <typename ForwardIt, typename T>
+void fill(ForwardIt first, ForwardIt last, const T& value) {
+  std::fill(ft::unwrap(first), ft::unwrap(last), value);
+}
+
+// Contiguous ranges of the same arithmetic type use the SIMD comparison
+// ft::vector's operator< uses.
+template <typename InputIt1, typename InputIt2>
+bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
+  typedef typename ft::iterator_traits<InputIt2>::value_type T2;
+  return _detail::lexicographical_compare(first1, last1, first2, last2, _detail::bool_tag<
+    _detail::simd_range<InputIt1, T2>::value && _detail::contiguous<InputIt2>::value>());
+}
+
+template <typename InputIt1, typename InputIt2, typename Compare>
+bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+                             Compare comp) {
+  return std::lexicographical_compare(ft::unwrap(first1), ft::unwrap(last1),
+                                      ft::unwrap(first2), ft::unwrap(last2), comp);
+}
+
+// Searches and comparisons. Ranges of arithmetic values in contiguous
+// storage (ft::vector iterators, pointers) run the SSE2/AVX2 kernels of
+// utils/simd.hpp; everything else takes the element-by-element loop.
+
+template <typename InputIt, typename T>
+InputIt find(InputIt first, InputIt last, const T& value) {
+  return _detail::find(first, last, value,
+                       _detail::bool_tag<_detail::simd_range<InputIt, T>::value>());
+}
+
+template <typename InputIt, typename T>
+typename ft::iterator_traits<InputIt>::difference_type
+count(InputIt first, InputIt last, const T& value) {
+  return _detail::count(first, last, value,
+                        _detail::bool_tag<_detail::simd_range<InputIt, T>::value>());
+}
+
+template <typename ForwardIt>
+ForwardIt min_element(ForwardIt first, ForwardIt last) {
+  return _detail::extreme_element<false>(first, last,
+                                         _detail::bool_tag<_detail::simd_range<ForwardIt>::minmax>());
+}
+
+template <typename ForwardIt, typename Compare>
+ForwardIt min_element(ForwardIt first, ForwardIt last, Compare comp) {
+  if (first == last)
+    return last;
+  ForwardIt best = first;
+  for (++first; first != last; ++first)
+    if (comp(*first, *best))
+      best = first;
+  return best;
+}
+
+template <typename ForwardIt>
+ForwardIt max_element(ForwardIt first, ForwardIt last) {
+  return _detail::extreme_element<true>(first, last,
+                                        _detail::bool_tag<_detail::simd_range<ForwardIt>::minmax>());
+}
+
+template <typename ForwardIt, typename Compare>
+ForwardIt max_element(ForwardIt first, ForwardIt last, Compare comp) {
+  if (first == last)
+    return last;
+  ForwardIt best = first;
+  for (++first; first != last; ++first)
+    if (comp(*best, *first))
+      best = first;
+  return best;
+}
+
+template <typename InputIt1, typename InputIt2>
+std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+  typedef typename ft::iterator_traits<InputIt2>::value_type T2;
+  return _detail::mismatch(first1, last1, first2, _detail::bool_tag<
+    _detail::simd_range<InputIt1, T2>::value && _detail::contiguous<InputIt2>::value>());
+}
+
+template <typename InputIt1, typename InputIt2, typename BinaryPredicate>
+std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                                       BinaryPredicate pred) {
+  while (first1 != last1 && pred(*first1, *first2)) {
+    ++first1;
+    ++first2;
+  }
+  return std::make_pair(first1, first2);
+}
+
+template <typename InputIt1, typename InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+  typedef typename ft::iterator_traits<InputIt2>::value_type T2;
+  return _detail::equal(first1, last1, first2, _detail::bool_tag<
+    _detail::simd_range<InputIt1, T2>::value && _detail::contiguous<InputIt2>::value>());
+}
+
+template <typename InputIt1, typename InputIt2, typename BinaryPredicate>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, BinaryPredicate pred) {
+  for (; first1 != last1; ++first1, ++first2)
+    if (!pred(*first1, *first2))
+      return false;
+  return true;
+}
+
+} // namespace ft
+
+#undef FT_SORT_MOVE
+
+#endif // FT_ALGORITHM_HPP
@@ -0,0 +1,259 @@
+// Bounded multi-producer/multi-consumer queue after Dmitry Vyukov's design:
+// every slot carries a sequence number that tells producers and consumers
+// whose turn it is, so the fast path is one CAS and no locks.
+// Requires C++11 (std::atomic, std::condition_variable).
+
+#ifndef FT_MPMC_QUEUE_HPP
+#define FT_MPMC_QUEUE_HPP
+
+#if __cplusplus < 201103L
+# error "concurrency/mpmc_queue.hpp requires C++11"
+#endif
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include "exception.hpp"
+#include "utils/cache_line.hpp"
+
+namespace ft {
+
+template <typename T, typename Alloc = std::allocator<T> >
+class mpmc_queue {
+public:
+  typedef T                                      value_type;
+  typedef Alloc                                  allocator_type;
+  typedef typename allocator_type::pointer       pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  typedef std::size_t                            size_type;
+
+private:
+  // Slot at index i is free for the producer of position p when
+  // sequence == p, and holds a value for the consumer of p when
+  // sequence == p + 1.
+  struct cell {
+    std::atomic<size_type> sequence;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+    T* value() { return reinterpret_cast<T*>(&storage); }
+  };
+
+  typedef typename Alloc::template rebind<cell>::other cell_allocator_type;
+
+  // Spins before a blocking call parks the thread.
+  static const int SPIN_LIMIT = 64;
+
+  // Each waiter count shares a line with the position the waking side
+  // just claimed, so the read-modify-write in wake() rarely misses.
+  alignas(ft::cache_line_size) std::atomic<size_type> _enqueue_pos;
+  std::atomic<int>                                     _pop_waiters;
+  alignas(ft::cache_line_size) std::atomic<size_type> _dequeue_pos;
+  std::atomic<int>                                     _push_waiters;
+
+  alignas(ft::cache_line_size) cell_allocator_type _cell_alloc;
+  cell*     _cells;
+  size_type _mask;
+
+  // Parking state for the blocking wrappers
+  alignas(ft::cache_line_size) std::mutex _park_lock;
+  std::condition_variable _not_full;
+  std::condition_variable _not_empty;
+
+  static size_type round_up_pow2(size_type n) {
+    size_type cap = 1;
+    while (cap < n)
+      cap <<= 1;
+    return cap;
+  }
+
+  static std::ptrdiff_t distance(size_type seq, size_type pos) {
+    return static_cast<std::ptrdiff_t>(seq - pos);
+  }
+
+  // Wakes a parked thread of the other side. Parkers increment the count
+  // before re-checking the queue. Reading it with a read-modify-write
+  // after the slot publication means either our RMW sees the increment,
+  // or the increment reads our RMW and so acquires the publication. A
+  // batch that made room for more than one element wakes every waiter.
+  void wake(std::atomic<int>& waiters, std::condition_variable& cond, size_type slots = 1) {
+    if (waiters.fetch_add(0, std::memory_order_acq_rel) > 0) {
+      std::lock_guard<std::mutex> guard(_park_lock);
+      if (slots > 1)
+        cond.notify_all();
+      else
+        cond.notify_one();
+    }
+  }
+
+  cell* claim_push_slot(size_type& pos) {
+    pos = _enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+      cell* c = _cells + (pos & _mask);
+      std::ptrdiff_t dif = distance(c->sequence.load(std::memory_order_acquire), pos);
+      if (dif == 0) {
+        if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          return c;
+      } else if (dif < 0) {
+        return NULL;
+      } else {
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Claims up to n consecutive ready slots for the consumer with one CAS.
+  size_type claim_pop_slots(size_type& pos, size_type n) {
+    pos = _dequeue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+      size_type ready = 0;
+      while (ready < n && ready <= _mask) {
+        cell* c = _cells + ((pos + ready) & _mask);
+        if (distance(c->sequence.load(std::memory_order_acquire), pos + ready + 1) != 0)
+          break;
+        ++ready;
+      }
+      if (ready == 0) {
+        cell* c = _cells + (pos & _mask);
+        std::ptrdiff_t dif = distance(c->sequence.load(std::memory_order_acquire), pos + 1);
+        if (dif < 0)
+          return 0;
+        pos = _dequeue_pos.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (_dequeue_pos.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed))
+        return ready;
+    }
+  }
+
+  void release_pop_slot(cell* c, size_type pos, value_type& out) {
+    out = std::move(*c->value());
+    c->value()->~T();
+    c->sequence.store(pos + _mask + 1, std::memory_order_release);
+  }
+
+  bool do_push(const value_type& val) {
+    size_type pos;
+    cell* c = claim_push_slot(pos);
+    if (!c)
+      return false;
+    ::new (static_cast<void*>(c->value())) T(val);
+    c->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_type do_pop_n(pointer dst, size_type n) {
+    size_type pos;
+    size_type got = claim_pop_slots(pos, n);
+    for (size_type i = 0; i < got; ++i)
+      release_pop_slot(_cells + ((pos + i) & _mask), pos + i, dst[i]);
+    return got;
+  }
+
+public:
+  explicit mpmc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+    : _enqueue_pos(0), _pop_waiters(0), _dequeue_pos(0), _push_waiters(0),
+      _cell_alloc(alloc), _cells(NULL), _mask(0) {
+    if (capacity < 2 || capacity > _cell_alloc.max_size())
+      throw ft::length_error("mpmc_queue: invalid capacity");
+    size_type cap = round_up_pow2(capacity);
+    _cells = _cell_alloc.allocate(cap);
+    for (size_type i = 0; i < cap; ++i)
+      ::new (static_cast<void*>(&_cells[i].sequence)) std::atomic<size_type>(i);
+    _mask = cap - 1;
+  }
+
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+  ~mpmc_queue() {
+    size_type tail = _enqueue_pos.load(std::memory_order_relaxed);
+    for (size_type pos = _dequeue_pos.load(std::memory_order_relaxed); pos != tail; ++pos)
+      _cells[pos & _mask].value()->~T();
+    _cell_alloc.deallocate(_cells, capacity());
+  }
+
+  // Capacity. size_approx() is a snapshot and may be stale on return.
+  size_type capacity() const { return _mask + 1; }
+
+  size_type size_approx() const {
+    size_type tail = _enqueue_pos.load(std::memory_order_acquire);
+    size_type head = _dequeue_pos.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  // Non-blocking operations
+  bool try_push(const value_type& val) {
+    if (!do_push(val))
+      return false;
+    wake(_pop_waiters, _not_empty);
+    return true;
+  }
+
+  bool try_pop(value_type& out) {
+    if (do_pop_n(&out, 1) == 0)
+      return false;
+    wake(_push_waiters, _not_full);
+    return true;
+  }
+
+  // Batch dequeue: takes up to n already-published elements at once.
+  // Returns the number of elements written to dst.
+  size_type try_pop_n(pointer dst, size_type n) {
+    size_type got = do_pop_n(dst, n);
+    if (got)
+      wake(_push_waiters, _not_full, got);
+    return got;
+  }
+
+  // Blocking wrappers: spin briefly, then park on a condition variable
+  // until the other side makes progress.
+  void push(const value_type& val) {
+    for (int i = 0; i < SPIN_LIMIT; ++i)
+      if (try_push(val))
+        return;
+    {
+      std::unique_lock<std::mutex> lock(_park_lock);
+      _push_waiters.fetch_add(1, std::memory_order_seq_cst);
+      while (!do_push(val))
+        _not_full.wait(lock);
+      _push_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+    wake(_pop_waiters, _not_empty);
+  }
+
+  void pop(value_type& out) {
+    pop_n(&out, 1);
+  }
+
+  // Blocks until at least one element is available, then takes up to n.
+  size_type pop_n(pointer dst, size_type n) {
+    if (n == 0)
+      return 0;
+    for (int i = 0; i < SPIN_LIMIT; ++i) {
+      size_type got = try_pop_n(dst, n);
+      if (got)
+        return got;
+    }
+    size_type got;
+    {
+      std::unique_lock<std::mutex> lock(_park_lock);
+      _pop_waiters.fetch_add(1, std::memory_order_seq_cst);
+      while ((got = do_pop_n(dst, n)) == 0)
+        _not_empty.wait(lock);
+      _pop_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+    wake(_push_waiters, _not_full, got);
+    return got;
+  }
+
+  allocator_type get_allocator() const { return allocator_type(_cell_alloc); }
+};
+
+} // namespace ft
+
+#endif // FT_MPMC_QUEUE_HPP
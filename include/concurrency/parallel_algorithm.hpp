@@ -0,0 +1,330 @@
+// Parallel algorithms over random access ranges such as ft::vector, run on
+// an ft::thread_pool. Ranges smaller than the executor's serial threshold
+// are processed inline. Requires C++11.
+
+#ifndef FT_PARALLEL_ALGORITHM_HPP
+#define FT_PARALLEL_ALGORITHM_HPP
+
+#if __cplusplus < 201103L
+# error "concurrency/parallel_algorithm.hpp requires C++11"
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <iterator>
+#include <cstddef>
+#include "vector.hpp"
+#include "algorithm.hpp"
+#include "concurrency/thread_pool.hpp"
+
+namespace ft {
+
+// Owns the pool the parallel algorithms run on.
+class parallel_executor {
+public:
+  static const std::size_t DEFAULT_SERIAL_THRESHOLD = 1 << 14;
+
+private:
+  std::unique_ptr<thread_pool> _pool;
+  std::size_t                  _threshold;
+
+public:
+  // threads == 0 picks std::thread::hardware_concurrency().
+  explicit parallel_executor(std::size_t threads = 0,
+                             std::size_t serial_threshold = DEFAULT_SERIAL_THRESHOLD)
+    : _pool(new thread_pool(threads)), _threshold(serial_threshold ? serial_threshold : 1) {}
+
+  thread_pool& pool() { return *_pool; }
+  std::size_t threads() const { return _pool->size(); }
+  std::size_t serial_threshold() const { return _threshold; }
+  void set_serial_threshold(std::size_t n) { _threshold = n ? n : 1; }
+
+  // Replaces the pool; must not race with algorithms running on it.
+  void set_threads(std::size_t threads) {
+    _pool.reset();
+    _pool.reset(new thread_pool(threads));
+  }
+
+  // Chunk size: never below the serial threshold or 2, about eight
+  // chunks per worker above it.
+  std::size_t grain(std::size_t n) const {
+    return std::max(std::max(_threshold, std::size_t(2)), n / (8 * threads()));
+  }
+};
+
+// Executor used by the overloads that do not take one.
+inline parallel_executor& default_parallel_executor() {
+  static parallel_executor exec;
+  return exec;
+}
+
+inline void set_parallel_thread_count(std::size_t threads) {
+  default_parallel_executor().set_threads(threads);
+}
+
+namespace _detail {
+
+template <typename RandomIt, typename T, typename BinaryOp>
+T reduce_range(parallel_executor& exec, RandomIt first, RandomIt last,
+               std::size_t grain, BinaryOp& op) {
+  std::size_t n = last - first;
+  if (n <= grain) {
+    T acc = *first;
+    for (++first; first != last; ++first)
+      acc = op(acc, *first);
+    return acc;
+  }
+  RandomIt mid = first + n / 2;
+  T left = *first;
+  T right = *mid;
+  exec.pool().parallel_invoke(
+    [&]() { left = reduce_range<RandomIt, T>(exec, first, mid, grain, op); },
+    [&]() { right = reduce_range<RandomIt, T>(exec, mid, last, grain, op); });
+  return op(left, right);
+}
+
+template <typename RandomIt, typename Predicate>
+typename std::iterator_traits<RandomIt>::difference_type
+count_range(parallel_executor& exec, RandomIt first, RandomIt last,
+            std::size_t grain, Predicate& pred) {
+  typedef typename std::iterator_traits<RandomIt>::difference_type diff_t;
+  std::size_t n = last - first;
+  if (n <= grain)
+    return std::count_if(first, last, pred);
+  RandomIt mid = first + n / 2;
+  diff_t left = 0, right = 0;
+  exec.pool().parallel_invoke(
+    [&]() { left = count_range(exec, first, mid, grain, pred); },
+    [&]() { right = count_range(exec, mid, last, grain, pred); });
+  return left + right;
+}
+
+// Merges [a1, a2) and [b1, b2) into out by splitting the larger input at
+// its midpoint and binary-searching the split point in the other. Once
+// the larger input is a single element a split cannot shrink it, so that
+// case merges serially too.
+template <typename InIt, typename OutIt, typename Compare>
+void merge_ranges(parallel_executor& exec, InIt a1, InIt a2, InIt b1, InIt b2,
+                  OutIt out, std::size_t grain, Compare& comp) {
+  std::size_t na = a2 - a1;
+  std::size_t nb = b2 - b1;
+  if (na < nb) {
+    std::swap(a1, b1);
+    std::swap(a2, b2);
+    std::swap(na, nb);
+  }
+  if (na <= 1 || na + nb <= grain) {
+    std::merge(a1, a2, b1, b2, out, comp);
+    return;
+  }
+  InIt am = a1 + na / 2;
+  InIt bm = std::lower_bound(b1, b2, *am, comp);
+  OutIt out_mid = out + (am - a1) + (bm - b1);
+  exec.pool().parallel_invoke(
+    [&]() { merge_ranges(exec, a1, am, b1, bm, out, grain, comp); },
+    [&]() { merge_ranges(exec, am, a2, bm, b2, out_mid, grain, comp); });
+}
+
+// Sorts n elements held in both a and buf, leaving the result in a when
+// in_a is set and in buf otherwise. Halves are sorted into the opposite
+// array, so every level costs exactly one merge pass.
+template <typename RandomIt, typename T, typename Compare>
+void sort_range(parallel_executor& exec, RandomIt a, T* buf, std::size_t n,
+                bool in_a, std::size_t grain, Compare& comp) {
+  if (n <= grain) {
+    ft::sort(a, a + n, comp);
+    if (!in_a)
+      std::copy(a, a + n, buf);
+    return;
+  }
+  std::size_t m = n / 2;
+  exec.pool().parallel_invoke(
+    [&]() { sort_range(exec, a, buf, m, !in_a, grain, comp); },
+    [&]() { sort_range(exec, a + m, buf + m, n - m, !in_a, grain, comp); });
+  if (in_a)
+    merge_ranges(exec, buf, buf + m, buf + m, buf + n, a, grain, comp);
+  else
+    merge_ranges(exec, a, a + m, a + m, a + n, buf, grain, comp);
+}
+
+} // namespace _detail
+
+// for_each
+template <typename RandomIt, typename UnaryFunction>
+void parallel_for_each(parallel_executor& exec, RandomIt first, RandomIt last, UnaryFunction f) {
+  std::size_t n = last - first;
+  if (n <= exec.serial_threshold()) {
+    std::for_each(first, last, f);
+    return;
+  }
+  exec.pool().parallel_for(std::size_t(0), n, exec.grain(n),
+    [&](std::size_t lo, std::size_t hi) { std::for_each(first + lo, first + hi, f); });
+}
+
+template <typename RandomIt, typename UnaryFunction>
+void parallel_for_each(RandomIt first, RandomIt last, UnaryFunction f) {
+  parallel_for_each(default_parallel_executor(), first, last, f);
+}
+
+// transform
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+OutputIt parallel_transform(parallel_executor& exec, RandomIt first, RandomIt last,
+                            OutputIt d_first, UnaryOperation op) {
+  std::size_t n = last - first;
+  if (n <= exec.serial_threshold())
+    return std::transform(first, last, d_first, op);
+  exec.pool().parallel_for(std::size_t(0), n, exec.grain(n),
+    [&](std::size_t lo, std::size_t hi) { std::transform(first + lo, first + hi, d_first + lo, op); });
+  return d_first + n;
+}
+
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+OutputIt parallel_transform(RandomIt first, RandomIt last, OutputIt d_first, UnaryOperation op) {
+  return parallel_transform(default_parallel_executor(), first, last, d_first, op);
+}
+
+// copy
+template <typename RandomIt, typename OutputIt>
+OutputIt parallel_copy(parallel_executor& exec, RandomIt first, RandomIt last, OutputIt d_first) {
+  std::size_t n = last - first;
+  if (n <= exec.serial_threshold())
+    return std::copy(first, last, d_first);
+  exec.pool().parallel_for(std::size_t(0), n, exec.grain(n),
+    [&](std::size_t lo, std::size_t hi) { std::copy(first + lo, first + hi, d_first + lo); });
+  return d_first + n;
+}
+
+template <typename RandomIt, typename OutputIt>
+OutputIt parallel_copy(RandomIt first, RandomIt last, OutputIt d_first) {
+  return parallel_copy(default_parallel_executor(), first, last, d_first);
+}
+
+// reduce: op must be associative and commutative, and callable as both
+// op(T, T) and op(T, value_type). Partial sums start from an element
+// converted to T; init is folded in once.
+template <typename RandomIt, typename T, typename BinaryOp>
+T parallel_reduce(parallel_executor& exec, RandomIt first, RandomIt last, T init, BinaryOp op) {
+  if (first == last)
+    return init;
+  std::size_t n = last - first;
+  std::size_t grain = n <= exec.serial_threshold() ? n : exec.grain(n);
+  T sum = _detail::reduce_range<RandomIt, T>(exec, first, last, grain, op);
+  return op(init, sum);
+}
+
+template <typename RandomIt, typename T>
+T parallel_reduce(parallel_executor& exec, RandomIt first, RandomIt last, T init) {
+  return parallel_reduce(exec, first, last, init, std::plus<T>());
+}
+
+template <typename RandomIt, typename T, typename BinaryOp>
+T parallel_reduce(RandomIt first, RandomIt last, T init, BinaryOp op) {
+  return parallel_reduce(default_parallel_executor(), first, last, init, op);
+}
+
+template <typename RandomIt, typename T>
+T parallel_reduce(RandomIt first, RandomIt last, T init) {
+  return parallel_reduce(default_parallel_executor(), first, last, init, std::plus<T>());
+}
+
+// count_if
+template <typename RandomIt, typename Predicate>
+typename std::iterator_traits<RandomIt>::difference_type
+parallel_count_if(parallel_executor& exec, RandomIt first, RandomIt last, Predicate pred) {
+  std::size_t n = last - first;
+  if (n <= exec.serial_threshold())
+    return std::count_if(first, last, pred);
+  return _detail::count_range(exec, first, last, exec.grain(n), pred);
+}
+
+template <typename RandomIt, typename Predicate>
+typename std::iterator_traits<RandomIt>::difference_type
+parallel_count_if(RandomIt first, RandomIt last, Predicate pred) {
+  return parallel_count_if(default_parallel_executor(), first, last, pred);
+}
+
+// sort: parallel merge sort with ft::sort leaves. Not stable. Needs a
+// scratch copy of the range, so value_type must be copy constructible.
+// If a copy or comp throws, the scratch copy is destroyed and the range is
+// left holding valid but unspecified values.
+template <typename RandomIt, typename Compare>
+void parallel_sort(parallel_executor& exec, RandomIt first, RandomIt last, Compare comp) {
+  typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+  std::size_t n = last - first;
+  if (n <= exec.serial_threshold()) {
+    ft::sort(first, last, comp);
+    return;
+  }
+  std::allocator<value_type> alloc;
+  std::size_t grain = exec.grain(n);
+  std::size_t chunks = (n + grain - 1) / grain;
+  // Chunks are copied in parallel; each records whether it was built
+  ft::vector<char> built(chunks, 0);
+  value_type* buf = alloc.allocate(n);
+  auto release = [&]() {
+    for (std::size_t k = 0; k < chunks; ++k)
+      if (built[k])
+        for (std::size_t i = k * grain; i < std::min(n, (k + 1) * grain); ++i)
+          alloc.destroy(buf + i);
+    alloc.deallocate(buf, n);
+  };
+  try {
+    exec.pool().parallel_for(std::size_t(0), chunks, std::size_t(1),
+      [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t k = lo; k < hi; ++k) {
+          std::size_t end = std::min(n, (k + 1) * grain);
+          std::uninitialized_copy(first + k * grain, first + end, buf + k * grain);
+          built[k] = 1;
+        }
+      });
+    _detail::sort_range(exec, first, buf, n, true, grain, comp);
+  } catch (...) {
+    release();
+    throw;
+  }
+  release();
+}
+
+template <typename RandomIt>
+void parallel_sort(parallel_executor& exec, RandomIt first, RandomIt last) {
+  typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+  parallel_sort(exec, first, last, std::less<value_type>());
+}
+
+template <typename RandomIt, typename Compare>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp) {
+  parallel_sort(default_parallel_executor(), first, last, comp);
+}
+
+template <typename RandomIt>
+void parallel_sort(RandomIt first, RandomIt last) {
+  typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+  parallel_sort(default_parallel_executor(), first, last, std::less<value_type>());
+}
+
+// ft::vector conveniences
+template <typename T, typename Alloc, typename Growth>
+void parallel_sort(ft::vector<T, Alloc, Growth>& v) {
+  parallel_sort(v.begin(), v.end());
+}
+
+template <typename T, typename Alloc, typename Growth, typename UnaryFunction>
+void parallel_for_each(ft::vector<T, Alloc, Growth>& v, UnaryFunction f) {
+  parallel_for_each(v.begin(), v.end(), f);
+}
+
+template <typename T, typename Alloc, typename Growth, typename U, typename BinaryOp>
+U parallel_reduce(const ft::vector<T, Alloc, Growth>& v, U init, BinaryOp op) {
+  return parallel_reduce(v.begin(), v.end(), init, op);
+}
+
+template <typename T, typename Alloc, typename Growth, typename Predicate>
+typename ft::vector<T, Alloc, Growth>::difference_type
+parallel_count_if(const ft::vector<T, Alloc, Growth>& v, Predicate pred) {
+  return parallel_count_if(v.begin(), v.end(), pred);
+}
+
+} // namespace ft
+
+#endif // FT_PARALLEL_ALGORITHM_HPP
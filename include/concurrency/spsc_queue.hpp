@@ -0,0 +1,165 @@
+// Bounded wait-free queue for exactly one producer thread and one consumer
+// thread. Requires C++11 (std::atomic).
+
+#ifndef FT_SPSC_QUEUE_HPP
+#define FT_SPSC_QUEUE_HPP
+
+#if __cplusplus < 201103L
+# error "concurrency/spsc_queue.hpp requires C++11"
+#endif
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+#include "exception.hpp"
+#include "utils/cache_line.hpp"
+
+namespace ft {
+
+// Head and tail are ever-increasing counters masked into a power-of-two
+// buffer. Each side keeps a private copy of the other side's counter and
+// only re-reads the shared one when the copy says the queue is full (or
+// empty), so in steady state the two cores do not touch each other's line.
+template <typename T, typename Alloc = std::allocator<T> >
+class spsc_queue {
+public:
+  typedef T                                      value_type;
+  typedef Alloc                                  allocator_type;
+  typedef typename allocator_type::pointer       pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  typedef std::size_t                            size_type;
+
+private:
+  // Consumer-owned line
+  alignas(ft::cache_line_size) std::atomic<size_type> _head;
+  size_type _tail_cache;
+
+  // Producer-owned line
+  alignas(ft::cache_line_size) std::atomic<size_type> _tail;
+  size_type _head_cache;
+
+  // Read-only after construction
+  alignas(ft::cache_line_size) allocator_type _alloc;
+  pointer   _data;
+  size_type _mask;
+
+  static size_type round_up_pow2(size_type n) {
+    size_type cap = 1;
+    while (cap < n)
+      cap <<= 1;
+    return cap;
+  }
+
+public:
+  explicit spsc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+    : _head(0), _tail_cache(0), _tail(0), _head_cache(0),
+      _alloc(alloc), _data(NULL), _mask(0) {
+    if (capacity == 0 || capacity > _alloc.max_size())
+      throw ft::length_error("spsc_queue: invalid capacity");
+    size_type cap = round_up_pow2(capacity);
+    _data = _alloc.allocate(cap);
+    _mask = cap - 1;
+  }
+
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+
+  ~spsc_queue() {
+    size_type tail = _tail.load(std::memory_order_relaxed);
+    for (size_type i = _head.load(std::memory_order_relaxed); i != tail; ++i)
+      _alloc.destroy(_data + (i & _mask));
+    _alloc.deallocate(_data, capacity());
+  }
+
+  // Capacity. size_approx() and empty() are exact only when called from the
+  // producer or consumer while the other side is idle.
+  size_type capacity() const { return _mask + 1; }
+
+  // Head is read first: tail only grows, so the difference cannot wrap,
+  // but it may overshoot by what was popped in between.
+  size_type size_approx() const {
+    size_type head = _head.load(std::memory_order_acquire);
+    size_type tail = _tail.load(std::memory_order_acquire);
+    return std::min(tail - head, capacity());
+  }
+
+  bool empty() const { return size_approx() == 0; }
+
+  // Producer side
+  bool try_push(const value_type& val) {
+    size_type tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head_cache == capacity()) {
+      _head_cache = _head.load(std::memory_order_acquire);
+      if (tail - _head_cache == capacity())
+        return false;
+    }
+    _alloc.construct(_data + (tail & _mask), val);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Pushes up to n elements from src with a single publication of the tail.
+  // Returns the number of elements pushed.
+  size_type try_push_n(const_pointer src, size_type n) {
+    size_type tail = _tail.load(std::memory_order_relaxed);
+    if (capacity() - (tail - _head_cache) < n)
+      _head_cache = _head.load(std::memory_order_acquire);
+    n = std::min(n, capacity() - (tail - _head_cache));
+    if (n == 0)
+      return 0;
+    size_type offset = tail & _mask;
+    size_type first = std::min(n, capacity() - offset);
+    for (size_type i = 0; i < first; ++i)
+      _alloc.construct(_data + offset + i, src[i]);
+    for (size_type i = first; i < n; ++i)
+      _alloc.construct(_data + (i - first), src[i]);
+    _tail.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  // Consumer side
+  bool try_pop(value_type& out) {
+    size_type head = _head.load(std::memory_order_relaxed);
+    if (head == _tail_cache) {
+      _tail_cache = _tail.load(std::memory_order_acquire);
+      if (head == _tail_cache)
+        return false;
+    }
+    pointer p = _data + (head & _mask);
+    out = std::move(*p);
+    _alloc.destroy(p);
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Pops up to n elements into dst with a single publication of the head.
+  // Returns the number of elements popped.
+  size_type try_pop_n(pointer dst, size_type n) {
+    size_type head = _head.load(std::memory_order_relaxed);
+    if (_tail_cache - head < n)
+      _tail_cache = _tail.load(std::memory_order_acquire);
+    n = std::min(n, _tail_cache - head);
+    if (n == 0)
+      return 0;
+    size_type offset = head & _mask;
+    size_type first = std::min(n, capacity() - offset);
+    for (size_type i = 0; i < first; ++i) {
+      dst[i] = std::move(_data[offset + i]);
+      _alloc.destroy(_data + offset + i);
+    }
+    for (size_type i = first; i < n; ++i) {
+      dst[i] = std::move(_data[i - first]);
+      _alloc.destroy(_data + (i - first));
+    }
+    _head.store(head + n, std::memory_order_release);
+    return n;
+  }
+
+  allocator_type get_allocator() const { return _alloc; }
+};
+
+} // namespace ft
+
+#endif // FT_SPSC_QUEUE_HPP
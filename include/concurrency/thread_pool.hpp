@@ -0,0 +1,301 @@
+// Fork-join scheduler: one ft::ws_deque per worker thread, randomized
+// stealing, and parallel_invoke/parallel_for on top. This is the execution
+// substrate for the parallel algorithms over ft containers.
+// Requires C++11 (std::thread, std::atomic).
+
+#ifndef FT_THREAD_POOL_HPP
+#define FT_THREAD_POOL_HPP
+
+#if __cplusplus < 201103L
+# error "concurrency/thread_pool.hpp requires C++11"
+#endif
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <exception>
+#include <chrono>
+#include <algorithm>
+#include <cstddef>
+#include "concurrency/ws_deque.hpp"
+
+namespace ft {
+
+class thread_pool {
+private:
+  struct task {
+    std::atomic<bool>  done;
+    std::exception_ptr error;
+
+    task() : done(false) {}
+    virtual ~task() {}
+    virtual void run() = 0;
+
+    virtual void complete() { done.store(true, std::memory_order_release); }
+
+    void execute() {
+      try {
+        run();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      complete();
+    }
+  };
+
+  // Runs a caller-owned callable; lives on the stack of the forking frame,
+  // which always joins it before returning.
+  template <typename F>
+  struct call_task : task {
+    F& fn;
+    explicit call_task(F& f) : fn(f) {}
+    void run() { fn(); }
+  };
+
+  struct worker {
+    ws_deque<task*> deque;
+    std::thread     thread;
+    unsigned        seed;
+  };
+
+  std::vector<std::unique_ptr<worker> > _workers;
+  std::mutex              _lock;      // guards _injected and parking
+  std::deque<task*>       _injected;  // root tasks from outside the pool
+  std::condition_variable _wake;
+  std::condition_variable _joined;
+  std::atomic<int>        _sleepers;
+  std::atomic<bool>       _stop;
+
+  // Spins of an idle worker before it parks.
+  static const int IDLE_SPINS = 64;
+
+  struct context {
+    thread_pool* pool;
+    worker*      self;
+  };
+
+  static context& current() {
+    static thread_local context ctx = { NULL, NULL };
+    return ctx;
+  }
+
+  worker* local_worker() {
+    context& ctx = current();
+    return ctx.pool == this ? ctx.self : NULL;
+  }
+
+  static unsigned next_random(unsigned& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+  }
+
+  void notify_sleepers() {
+    if (_sleepers.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> guard(_lock);
+      _wake.notify_one();
+    }
+  }
+
+  bool take_injected(task*& t) {
+    std::unique_lock<std::mutex> lock(_lock, std::try_to_lock);
+    if (!lock.owns_lock() || _injected.empty())
+      return false;
+    t = _injected.front();
+    _injected.pop_front();
+    return true;
+  }
+
+  // Tries every other worker once, starting from a random victim.
+  bool steal(worker* self, task*& t) {
+    std::size_t n = _workers.size();
+    std::size_t start = next_random(self->seed) % n;
+    for (std::size_t i = 0; i < n; ++i) {
+      worker* victim = _workers[(start + i) % n].get();
+      if (victim != self && victim->deque.steal(t))
+        return true;
+    }
+    return false;
+  }
+
+  bool find_task(worker* self, task*& t) {
+    return self->deque.pop(t) || take_injected(t) || steal(self, t);
+  }
+
+  void worker_loop(worker* self) {
+    context& ctx = current();
+    ctx.pool = this;
+    ctx.self = self;
+
+    int idle = 0;
+    while (!_stop.load(std::memory_order_acquire)) {
+      task* t;
+      if (find_task(self, t)) {
+        t->execute();
+        idle = 0;
+      } else if (++idle < IDLE_SPINS) {
+        std::this_thread::yield();
+      } else {
+        // Stolen work is not signalled, so parking is bounded
+        std::unique_lock<std::mutex> lock(_lock);
+        _sleepers.fetch_add(1, std::memory_order_relaxed);
+        if (_injected.empty() && !_stop.load(std::memory_order_relaxed))
+          _wake.wait_for(lock, std::chrono::milliseconds(1));
+        _sleepers.fetch_sub(1, std::memory_order_relaxed);
+        idle = 0;
+      }
+    }
+    ctx.pool = NULL;
+    ctx.self = NULL;
+  }
+
+  // Helps with other work until t has completed.
+  void wait_for(worker* self, task& t) {
+    while (!t.done.load(std::memory_order_acquire)) {
+      task* other;
+      if (steal(self, other) || take_injected(other))
+        other->execute();
+      else
+        std::this_thread::yield();
+    }
+  }
+
+  // Hands f to the pool from a thread that is not one of its workers and
+  // blocks until it has run.
+  template <typename F>
+  void run_external(F& f) {
+    // Completion is published under the pool lock, so the waiter cannot
+    // return and destroy the task while the notification is in flight.
+    struct external_task : task {
+      F&           fn;
+      thread_pool& pool;
+      external_task(F& f, thread_pool& p) : fn(f), pool(p) {}
+      void run() { fn(); }
+      void complete() {
+        std::lock_guard<std::mutex> guard(pool._lock);
+        task::complete();
+        pool._joined.notify_all();
+      }
+    };
+
+    external_task root(f, *this);
+    std::unique_lock<std::mutex> lock(_lock);
+    _injected.push_back(&root);
+    _wake.notify_one();
+    _joined.wait(lock, [&root]() { return root.done.load(std::memory_order_acquire); });
+    lock.unlock();
+    if (root.error)
+      std::rethrow_exception(root.error);
+  }
+
+public:
+  // threads == 0 picks std::thread::hardware_concurrency().
+  explicit thread_pool(std::size_t threads = 0)
+    : _sleepers(0), _stop(false) {
+    if (threads == 0)
+      threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for (std::size_t i = 0; i < threads; ++i) {
+      _workers.push_back(std::unique_ptr<worker>(new worker));
+      _workers.back()->seed = static_cast<unsigned>(2654435761u * (i + 1));
+    }
+    for (std::size_t i = 0; i < threads; ++i)
+      _workers[i]->thread = std::thread(&thread_pool::worker_loop, this, _workers[i].get());
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> guard(_lock);
+      _stop.store(true, std::memory_order_release);
+      _wake.notify_all();
+    }
+    for (std::size_t i = 0; i < _workers.size(); ++i)
+      _workers[i]->thread.join();
+  }
+
+  std::size_t size() const { return _workers.size(); }
+
+  // Runs f on the pool and waits for it; a no-op hop when already inside.
+  template <typename F>
+  void run(F&& f) {
+    if (local_worker())
+      f();
+    else
+      run_external(f);
+  }
+
+  // Runs f and g, potentially in parallel, and returns when both are done.
+  // g is offered to thieves while the calling worker runs f. The first
+  // exception thrown by either is rethrown after both have finished.
+  template <typename F, typename G>
+  void parallel_invoke(F&& f, G&& g) {
+    worker* self = local_worker();
+    if (!self) {
+      auto both = [&]() { parallel_invoke(f, g); };
+      run_external(both);
+      return;
+    }
+
+    call_task<G> right(g);
+    self->deque.push(&right);
+    notify_sleepers();
+
+    std::exception_ptr error;
+    try {
+      f();
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    // Everything pushed after `right` was joined inside f, so the bottom of
+    // the deque is either `right` or it has been stolen.
+    task* t;
+    if (self->deque.pop(t))
+      t->execute();
+    else
+      wait_for(self, right);
+
+    if (error)
+      std::rethrow_exception(error);
+    if (right.error)
+      std::rethrow_exception(right.error);
+  }
+
+  // Calls body(lo, hi) over disjoint subranges covering [first, last),
+  // splitting recursively until a range holds at most grain indices.
+  // grain == 0 picks about eight chunks per worker.
+  template <typename Index, typename F>
+  void parallel_for(Index first, Index last, Index grain, F&& body) {
+    if (!(first < last))
+      return;
+    if (grain == Index(0)) {
+      grain = static_cast<Index>((last - first) / (8 * size()));
+      if (grain == Index(0))
+        grain = Index(1);
+    }
+    split_for(first, last, grain, body);
+  }
+
+private:
+  template <typename Index, typename F>
+  void split_for(Index first, Index last, Index grain, F& body) {
+    if (last - first <= grain) {
+      body(first, last);
+      return;
+    }
+    Index mid = first + (last - first) / 2;
+    parallel_invoke([&]() { split_for(first, mid, grain, body); },
+                    [&]() { split_for(mid, last, grain, body); });
+  }
+};
+
+} // namespace ft
+
+#endif // FT_THREAD_POOL_HPP
@@ -0,0 +1,144 @@
+// Chase-Lev work-stealing deque, with the C11 memory orderings from
+// Le, Pop, Cohen and Zappa Nardelli, "Correct and Efficient Work-Stealing
+// for Weak Memory Models" (PPoPP 2013). The release fence in push is folded
+// into a release store of bottom, and the seq_cst fences in pop and steal
+// into seq_cst accesses of bottom and top, which ThreadSanitizer models.
+// Requires C++11 (std::atomic).
+
+#ifndef FT_WS_DEQUE_HPP
+#define FT_WS_DEQUE_HPP
+
+#if __cplusplus < 201103L
+# error "concurrency/ws_deque.hpp requires C++11"
+#endif
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include "utils/cache_line.hpp"
+
+namespace ft {
+
+// The owning thread pushes and pops at the bottom (LIFO); any other thread
+// may steal from the top (FIFO). T must be trivially copyable; in practice
+// it is a task pointer.
+//
+// The ring grows when full. Retired rings are kept until destruction
+// because a concurrent thief may still be reading from one.
+template <typename T>
+class ws_deque {
+private:
+  struct ring {
+    std::size_t         mask;
+    std::atomic<T>*     slots;
+
+    explicit ring(std::size_t capacity) : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+    ~ring() { delete[] slots; }
+
+    std::size_t capacity() const { return mask + 1; }
+    T get(std::ptrdiff_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+    void put(std::ptrdiff_t i, T x) { slots[i & mask].store(x, std::memory_order_relaxed); }
+
+    ring* grow(std::ptrdiff_t bottom, std::ptrdiff_t top) const {
+      ring* r = new ring(capacity() * 2);
+      for (std::ptrdiff_t i = top; i != bottom; ++i)
+        r->put(i, get(i));
+      return r;
+    }
+  };
+
+  // Thieves hammer _top while the owner works on _bottom. Explicit padding
+  // rather than alignas, so deques embedded in heap-allocated workers do not
+  // need over-aligned operator new.
+  char                         _pad0[ft::cache_line_size];
+  std::atomic<std::ptrdiff_t>  _top;
+  char                         _pad1[ft::cache_line_size - sizeof(std::atomic<std::ptrdiff_t>)];
+  std::atomic<std::ptrdiff_t>  _bottom;
+  std::atomic<ring*>           _ring;
+  std::vector<ring*>           _retired;
+  char                         _pad2[ft::cache_line_size];
+
+public:
+  explicit ws_deque(std::size_t capacity = 256)
+    : _top(0), _bottom(0), _ring(NULL) {
+    std::size_t cap = 1;
+    while (cap < capacity)
+      cap <<= 1;
+    _ring.store(new ring(cap), std::memory_order_relaxed);
+  }
+
+  ws_deque(const ws_deque&) = delete;
+  ws_deque& operator=(const ws_deque&) = delete;
+
+  ~ws_deque() {
+    delete _ring.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < _retired.size(); ++i)
+      delete _retired[i];
+  }
+
+  // Snapshot; exact only from the owner while no thief is active.
+  std::size_t size_approx() const {
+    std::ptrdiff_t b = _bottom.load(std::memory_order_relaxed);
+    std::ptrdiff_t t = _top.load(std::memory_order_relaxed);
+    return b > t ? static_cast<std::size_t>(b - t) : 0;
+  }
+
+  bool empty() const { return size_approx() == 0; }
+
+  // Owner only
+  void push(T x) {
+    std::ptrdiff_t b = _bottom.load(std::memory_order_relaxed);
+    std::ptrdiff_t t = _top.load(std::memory_order_acquire);
+    ring* r = _ring.load(std::memory_order_relaxed);
+    if (b - t > static_cast<std::ptrdiff_t>(r->capacity()) - 1) {
+      _retired.push_back(r);
+      r = r->grow(b, t);
+      _ring.store(r, std::memory_order_release);
+    }
+    r->put(b, x);
+    _bottom.store(b + 1, std::memory_order_release);
+  }
+
+  // Owner only
+  bool pop(T& out) {
+    std::ptrdiff_t b = _bottom.load(std::memory_order_relaxed) - 1;
+    ring* r = _ring.load(std::memory_order_relaxed);
+    _bottom.store(b, std::memory_order_seq_cst);
+    std::ptrdiff_t t = _top.load(std::memory_order_seq_cst);
+
+    if (t > b) {
+      _bottom.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+    T x = r->get(b);
+    if (t == b) {
+      // Last element: race thieves for it
+      bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+      _bottom.store(b + 1, std::memory_order_relaxed);
+      if (!won)
+        return false;
+    }
+    out = x;
+    return true;
+  }
+
+  // Any thread
+  bool steal(T& out) {
+    std::ptrdiff_t t = _top.load(std::memory_order_seq_cst);
+    std::ptrdiff_t b = _bottom.load(std::memory_order_seq_cst);
+    if (t >= b)
+      return false;
+    ring* r = _ring.load(std::memory_order_acquire);
+    T x = r->get(t);
+    if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return false;
+    out = x;
+    return true;
+  }
+};
+
+} // namespace ft
+
+#endif // FT_WS_DEQUE_HPP
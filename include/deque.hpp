@@ -10,7 +10,9 @@
 #include <algorithm>
 #include "deque_base.hpp"
 #include "iterators/deque_iterator.hpp"
+#include "iterators/iterator_traits.hpp"
 #include "utils/enable_if.hpp"
+#include "utils/uninitialized.hpp"
 
 namespace ft {
 
@@ -38,6 +40,8 @@ protected:
   using base::BLOCK_SIZE;
   using base::_map;
   using base::_map_capacity;
+  using base::_map_start;
+  using base::_map_end;
   using base::_allocator;
   using base::allocate_node;
   using base::deallocate_node;
@@ -46,23 +50,76 @@ protected:
   using base::create_nodes;
   using base::destroy_nodes;
   using base::initialize_map;
+  using base::reserve_blocks;
   using base::get_allocator;
 
   iterator begin_;
   iterator end_;
 
 private:
+  // Fills the blocks initialize_map set up, one block-sized run at a time.
   void initialize_storage(size_type count, const value_type& value) {
-    for (size_type i = 0; i < count; ++i)
-      push_back(value);
+    size_type left = count;
+    try {
+      for (size_type block = begin_._block_index; left; ++block) {
+        size_type n = std::min(left, static_cast<size_type>(BLOCK_SIZE));
+        ft::uninitialized_fill_n(_map[block], n, value, _allocator);
+        left -= n;
+        end_ = begin_ + (count - left);
+      }
+    } catch (...) {
+      ft::destroy(begin_, end_, _allocator);
+      end_ = begin_;
+      throw;
+    }
+  }
+
+  // Points both iterators at the first block, leaving the deque empty.
+  void reset_iterators() {
+    begin_ = end_ = iterator(_map, BLOCK_SIZE, _map_start - _map, 0);
+  }
+
+  // Re-targets the iterators after the map moved.
+  void rebase(std::ptrdiff_t shift) {
+    begin_ = iterator(_map, BLOCK_SIZE, begin_._block_index + shift, begin_._element_index);
+    end_ = iterator(_map, BLOCK_SIZE, end_._block_index + shift, end_._element_index);
+  }
+
+  // Makes room for count elements from the first block on.
+  void reserve_elements(size_type count) {
+    if (!_map) {
+      initialize_map(count);
+      reset_iterators();
+    } else {
+      rebase(reserve_blocks(count / BLOCK_SIZE + 1));
+    }
   }
 
+  // Input ranges can only be read once, so they grow block by block;
+  // forward ranges are counted and get every block before the first copy.
   template <class InputIterator>
-  void assign_range(InputIterator first, InputIterator last) {
+  void assign_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
     for (; first != last; ++first)
       push_back(*first);
   }
 
+  template <class ForwardIterator>
+  void assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+    reserve_elements(ft::distance(first, last));
+    try {
+      for (; first != last; ++first, ++end_)
+        _allocator.construct(&*end_, *first);
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  template <class InputIterator>
+  void assign_range(InputIterator first, InputIterator last) {
+    assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+  }
+
 public:
   // Constructors
   deque()
@@ -74,10 +131,7 @@ public:
   deque(size_type count, const value_type& value = value_type(),
         const allocator_type& alloc = allocator_type())
     : base(alloc, count) {
-    size_t num_blocks = count / BLOCK_SIZE + 1;
-    size_t start_block = (_map_capacity - num_blocks) / 2;
-    begin_ = iterator(_map, BLOCK_SIZE, start_block, 0);
-    end_ = begin_;
+    reset_iterators();
     initialize_storage(count, value);
   }
 
@@ -100,13 +154,25 @@ public:
   }
 
   deque& operator=(const deque& other) {
-    if (this != &other) {
-      clear();
-      assign_range(other.begin(), other.end());
-    }
+    if (this != &other)
+      assign(other.begin(), other.end());
     return *this;
   }
 
+  template <class InputIterator>
+  void assign(InputIterator first, InputIterator last,
+              typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+    clear();
+    assign_range(first, last);
+  }
+
+  void assign(size_type count, const value_type& value) {
+    value_type copy(value);  // value may live in this deque
+    clear();
+    reserve_elements(count);
+    initialize_storage(count, copy);
+  }
+
   // Basic iterator accessors
   iterator begin() { return begin_; }
   iterator end() { return end_; }
@@ -163,28 +229,20 @@ public:
 
   // Modifiers
   void clear() {
-    for (iterator it = begin_; it != end_; ++it)
-      _allocator.destroy(&*it);
-
-    size_t center = _map_capacity / 2;
-    begin_ = end_ = iterator(_map, BLOCK_SIZE, center, 0);
+    ft::destroy(begin_, end_, _allocator);
+    if (_map)
+      reset_iterators();
   }
 
+  // end_ always points into an allocated block or at the start of the one
+  // past the last, which is allocated (growing the map if needed) here.
+  // Blocks never move, so value stays valid even if it lives in the deque.
   void push_back(const value_type& value) {
-    if (end_._element_index == BLOCK_SIZE) {
-      // We need to move to a new block
-      if (end_._block_index + 1 >= _map_capacity) {
-        throw std::length_error("ft::deque push_back: map full");
-        // Optionally: grow the map here in future
-      }
-      if (_map[end_._block_index + 1] == 0)
-        _map[end_._block_index + 1] = allocate_node();
-
-      ++end_._block_index;
-      end_._element_index = 0;
-    }
-
-    _allocator.construct(&(*end_), value);
+    if (!_map)
+      reserve_elements(0);
+    if (_map + end_._block_index == _map_end)
+      rebase(reserve_blocks(_map_end - _map_start + 1));
+    _allocator.construct(&*end_, value);
     ++end_;
   }
 
@@ -16,6 +16,8 @@ protected:
   typedef typename Alloc::template rebind<T*>::other MapAllocator;
   typedef typename Alloc::template rebind<T>::other  NodeAllocator;
 
+  // Blocks are allocated contiguously in [_map_start, _map_end); the
+  // rest of the map is unused.
   T**              _map;
   size_t           _map_capacity;
   T**              _map_start;
@@ -95,6 +97,36 @@ protected:
     _map_start = start;
     _map_end = finish;
   }
+
+  // Moves the block pointers to the middle of a new map of new_capacity
+  // slots and returns how far block indices shifted.
+  std::ptrdiff_t reallocate_map(size_t new_capacity) {
+    size_t used = _map_end - _map_start;
+    T** new_map = allocate_map(new_capacity);
+    T** new_start = new_map + (new_capacity - used) / 2;
+    std::copy(_map_start, _map_end, new_start);
+    std::ptrdiff_t shift = (new_start - new_map) - (_map_start - _map);
+    deallocate_map(_map, _map_capacity);
+    _map = new_map;
+    _map_capacity = new_capacity;
+    _map_start = new_start;
+    _map_end = new_start + used;
+    return shift;
+  }
+
+  // Allocates blocks until count of them start at _map_start, growing the
+  // map first if they would not fit. Returns the index shift, if any.
+  std::ptrdiff_t reserve_blocks(size_t count) {
+    std::ptrdiff_t shift = 0;
+    if (count > _map_capacity - (_map_start - _map))
+      shift = reallocate_map(std::max(_map_capacity * 2, count * 2 + 2));
+    while (static_cast<size_t>(_map_end - _map_start) < count) {
+      T* block = allocate_node();
+      *_map_end = block;
+      ++_map_end;
+    }
+    return shift;
+  }
 };
 
 // Static member definitions (must be outside the class)
@@ -0,0 +1,287 @@
+// Resizable sequence of bits packed into unsigned long blocks, after boost's
+// dynamic_bitset. Single bits are read and written through a proxy
+// reference; count, find_first / find_next and the bulk operators work a
+// whole block, or a whole SIMD register of blocks, at a time (see
+// utils/bitops.hpp). Bits past size() in the last block are kept zero.
+
+#ifndef FT_DYNAMIC_BITSET_HPP
+#define FT_DYNAMIC_BITSET_HPP
+
+#include <memory>
+#include <cstddef>
+#include "exception.hpp"
+#include "vector.hpp"
+#include "utils/swap.hpp"
+#include "utils/bitops.hpp"
+
+namespace ft {
+
+template <typename Alloc = std::allocator<unsigned long> >
+class dynamic_bitset {
+public:
+  typedef _bits::word                                     block_type;
+  typedef typename Alloc::template rebind<block_type>::other allocator_type;
+  typedef std::size_t                                     size_type;
+  typedef bool                                            const_reference;
+
+  static const size_type bits_per_block = _bits::word_bits;
+  static const size_type npos = static_cast<size_type>(-1);
+
+  class reference {
+  public:
+    operator bool() const { return (*_block & _mask) != 0; }
+    bool operator~() const { return (*_block & _mask) == 0; }
+
+    reference& operator=(bool x) {
+      if (x)
+        *_block |= _mask;
+      else
+        *_block &= ~_mask;
+      return *this;
+    }
+
+    reference& operator=(const reference& x) { return *this = bool(x); }
+
+    reference& flip() {
+      *_block ^= _mask;
+      return *this;
+    }
+
+  private:
+    friend class dynamic_bitset;
+
+    block_type* _block;
+    block_type  _mask;
+
+    reference(block_type* block, size_type bit) : _block(block), _mask(block_type(1) << bit) {}
+  };
+
+private:
+  ft::vector<block_type, allocator_type> _blocks;
+  size_type                              _size;
+
+  static size_type blocks_for(size_type bits) { return (bits + bits_per_block - 1) / bits_per_block; }
+  static size_type block_index(size_type pos) { return pos / bits_per_block; }
+  static size_type bit_index(size_type pos) { return pos % bits_per_block; }
+
+  block_type* blocks() { return _blocks.empty() ? NULL : &_blocks[0]; }
+  const block_type* blocks() const { return _blocks.empty() ? NULL : &_blocks[0]; }
+
+  // Clears the unused bits of the last block.
+  void trim() {
+    if (bit_index(_size))
+      _blocks.back() &= (block_type(1) << bit_index(_size)) - 1;
+  }
+
+  void check(size_type pos, const char* what) const {
+    if (pos >= _size)
+      throw ft::out_of_range(what);
+  }
+
+  // Applies Op against x's blocks over the common prefix. Blocks past x's
+  // end are left alone, or cleared for AND.
+  template <typename Op>
+  dynamic_bitset& combine(const dynamic_bitset& x, bool zero_tail) {
+    size_type n = num_blocks() < x.num_blocks() ? num_blocks() : x.num_blocks();
+    _bits::combine<Op>(blocks(), x.blocks(), n);
+    if (zero_tail)
+      for (size_type i = n; i < num_blocks(); ++i)
+        _blocks[i] = 0;
+    trim();
+    return *this;
+  }
+
+  // First set bit at or after block b, or npos.
+  size_type scan_from(size_type b) const {
+    size_type n = num_blocks();
+    if (b >= n)
+      return npos;
+    b += _bits::find_nonzero(blocks() + b, n - b);
+    if (b == n)
+      return npos;
+    return b * bits_per_block + _bits::lowest_bit(_blocks[b]);
+  }
+
+public:
+  explicit dynamic_bitset(const allocator_type& alloc = allocator_type())
+    : _blocks(alloc), _size(0) {}
+
+  explicit dynamic_bitset(size_type n, bool value = false,
+                          const allocator_type& alloc = allocator_type())
+    : _blocks(blocks_for(n), value ? ~block_type(0) : block_type(0), alloc), _size(n) {
+    trim();
+  }
+
+  size_type size() const { return _size; }
+  bool empty() const { return _size == 0; }
+  size_type num_blocks() const { return _blocks.size(); }
+  size_type capacity() const { return _blocks.capacity() * bits_per_block; }
+  size_type max_size() const { return _blocks.max_size() * bits_per_block; }
+  allocator_type get_allocator() const { return _blocks.get_allocator(); }
+
+  // The packed blocks: bit i lives in block i / bits_per_block.
+  const block_type* data() const { return blocks(); }
+
+  void reserve(size_type n) { _blocks.reserve(blocks_for(n)); }
+
+  void resize(size_type n, bool value = false) {
+    if (value && n > _size && bit_index(_size))
+      _blocks.back() |= ~block_type(0) << bit_index(_size);
+    _blocks.resize(blocks_for(n), value ? ~block_type(0) : block_type(0));
+    _size = n;
+    trim();
+  }
+
+  void clear() {
+    _blocks.clear();
+    _size = 0;
+  }
+
+  void push_back(bool value) {
+    if (!bit_index(_size))
+      _blocks.push_back(0);
+    if (value)
+      _blocks.back() |= block_type(1) << bit_index(_size);
+    ++_size;
+  }
+
+  void pop_back() {
+    --_size;
+    if (!bit_index(_size))
+      _blocks.pop_back();
+    else
+      trim();
+  }
+
+  reference operator[](size_type pos) { return reference(&_blocks[block_index(pos)], bit_index(pos)); }
+  const_reference operator[](size_type pos) const { return test_unchecked(pos); }
+
+  bool test(size_type pos) const {
+    check(pos, "dynamic_bitset::test: pos out of range");
+    return test_unchecked(pos);
+  }
+
+  bool test_unchecked(size_type pos) const {
+    return (_blocks[block_index(pos)] >> bit_index(pos)) & 1;
+  }
+
+  dynamic_bitset& set() {
+    for (size_type i = 0; i < num_blocks(); ++i)
+      _blocks[i] = ~block_type(0);
+    trim();
+    return *this;
+  }
+
+  dynamic_bitset& set(size_type pos, bool value = true) {
+    check(pos, "dynamic_bitset::set: pos out of range");
+    (*this)[pos] = value;
+    return *this;
+  }
+
+  dynamic_bitset& reset() {
+    for (size_type i = 0; i < num_blocks(); ++i)
+      _blocks[i] = 0;
+    return *this;
+  }
+
+  dynamic_bitset& reset(size_type pos) {
+    check(pos, "dynamic_bitset::reset: pos out of range");
+    (*this)[pos] = false;
+    return *this;
+  }
+
+  dynamic_bitset& flip() {
+    _bits::complement(blocks(), num_blocks());
+    trim();
+    return *this;
+  }
+
+  dynamic_bitset& flip(size_type pos) {
+    check(pos, "dynamic_bitset::flip: pos out of range");
+    (*this)[pos].flip();
+    return *this;
+  }
+
+  size_type count() const { return _bits::count(blocks(), num_blocks()); }
+  bool any() const { return find_first() != npos; }
+  bool none() const { return !any(); }
+  bool all() const { return count() == _size; }
+
+  // Position of the first set bit, or npos.
+  size_type find_first() const { return scan_from(0); }
+
+  // Position of the first set bit after pos, or npos.
+  size_type find_next(size_type pos) const {
+    if (pos >= _size || ++pos == _size)
+      return npos;
+    block_type rest = _blocks[block_index(pos)] >> bit_index(pos);
+    if (rest)
+      return pos + _bits::lowest_bit(rest);
+    return scan_from(block_index(pos) + 1);
+  }
+
+  // The bulk operators treat a shorter x as padded with zeros.
+  dynamic_bitset& operator&=(const dynamic_bitset& x) { return combine<_bits::and_op>(x, true); }
+  dynamic_bitset& operator|=(const dynamic_bitset& x) { return combine<_bits::or_op>(x, false); }
+  dynamic_bitset& operator^=(const dynamic_bitset& x) { return combine<_bits::xor_op>(x, false); }
+  // Clears the bits set in x.
+  dynamic_bitset& operator-=(const dynamic_bitset& x) { return combine<_bits::andnot_op>(x, false); }
+
+  dynamic_bitset operator~() const {
+    dynamic_bitset result(*this);
+    return result.flip();
+  }
+
+  void swap(dynamic_bitset& other) {
+    _blocks.swap(other._blocks);
+    ft::swap(_size, other._size);
+  }
+
+  friend bool operator==(const dynamic_bitset& x, const dynamic_bitset& y) {
+    return x._size == y._size && x._blocks == y._blocks;
+  }
+};
+
+template <typename Alloc>
+const typename dynamic_bitset<Alloc>::size_type dynamic_bitset<Alloc>::bits_per_block;
+
+template <typename Alloc>
+const typename dynamic_bitset<Alloc>::size_type dynamic_bitset<Alloc>::npos;
+
+template <typename Alloc>
+bool operator!=(const dynamic_bitset<Alloc>& x, const dynamic_bitset<Alloc>& y) {
+  return !(x == y);
+}
+
+template <typename Alloc>
+dynamic_bitset<Alloc> operator&(const dynamic_bitset<Alloc>& x, const dynamic_bitset<Alloc>& y) {
+  dynamic_bitset<Alloc> result(x);
+  return result &= y;
+}
+
+template <typename Alloc>
+dynamic_bitset<Alloc> operator|(const dynamic_bitset<Alloc>& x, const dynamic_bitset<Alloc>& y) {
+  dynamic_bitset<Alloc> result(x);
+  return result |= y;
+}
+
+template <typename Alloc>
+dynamic_bitset<Alloc> operator^(const dynamic_bitset<Alloc>& x, const dynamic_bitset<Alloc>& y) {
+  dynamic_bitset<Alloc> result(x);
+  return result ^= y;
+}
+
+template <typename Alloc>
+dynamic_bitset<Alloc> operator-(const dynamic_bitset<Alloc>& x, const dynamic_bitset<Alloc>& y) {
+  dynamic_bitset<Alloc> result(x);
+  return result -= y;
+}
+
+template <typename Alloc>
+void swap(dynamic_bitset<Alloc>& x, dynamic_bitset<Alloc>& y) {
+  x.swap(y);
+}
+
+} // namespace ft
+
+#endif // FT_DYNAMIC_BITSET_HPP
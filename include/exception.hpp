@@ -24,6 +24,16 @@ public:
   }
 };
 
+class length_error : public std::length_error, public ft::exception {
+public:
+  explicit length_error(const std::string& what_arg)
+    : std::length_error(what_arg) {}
+
+  const char* what() const throw() {
+    return std::length_error::what();
+  }
+};
+
 } // namespace ft
 
 #endif // FT_EXCEPTION_HPP
@@ -0,0 +1,431 @@
+// Unordered container with stable element addresses, after plf::colony and
+// C++26 std::hive. Elements live in groups of slots whose capacity doubles
+// from group to group, like the node blocks of ft::deque. insert and erase
+// are O(1) and never move other elements: an erased slot is recorded in its
+// group's jump-counting skipfield, so iteration steps over any run of them
+// in one jump, and the run joins a free list that later inserts refill
+// before touching new slots. A group is freed when its last element goes.
+//
+// Insertion order is not kept: an insert may land in any erased slot.
+
+#ifndef FT_HIVE_HPP
+#define FT_HIVE_HPP
+
+#include <memory>
+#include <cstddef>
+#include <limits>
+#include <functional>
+#include "iterators/hive_iterator.hpp"
+#include "iterators/reverse_iterator.hpp"
+#include "utils/hive_group.hpp"
+#include "utils/enable_if.hpp"
+#include "utils/swap.hpp"
+
+namespace ft {
+
+template <typename T, typename Alloc = std::allocator<T> >
+class hive {
+public:
+  typedef T                                value_type;
+  typedef Alloc                            allocator_type;
+  typedef typename Alloc::reference        reference;
+  typedef typename Alloc::const_reference  const_reference;
+  typedef typename Alloc::pointer          pointer;
+  typedef typename Alloc::const_pointer    const_pointer;
+  typedef std::ptrdiff_t                   difference_type;
+  typedef std::size_t                      size_type;
+
+  typedef ft::hive_iterator<T, T>               iterator;
+  typedef ft::hive_iterator<const T, T>         const_iterator;
+  typedef ft::reverse_iterator<iterator>        reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  static const size_type min_group_capacity = 8;
+  static const size_type max_group_capacity = 8192;
+
+private:
+  typedef hive_group<T>                  group;
+  typedef typename group::slot           slot;
+  typedef typename group::skip_type      skip_type;
+  typedef typename Alloc::template rebind<group>::other     group_allocator_type;
+  typedef typename Alloc::template rebind<slot>::other      slot_allocator_type;
+  typedef typename Alloc::template rebind<skip_type>::other skip_allocator_type;
+
+  group*               _front;
+  group*               _back;
+  group*               _free_groups;  // groups whose free list is not empty
+  size_type            _size;
+  size_type            _capacity;
+  allocator_type       _alloc;
+  group_allocator_type _group_alloc;
+  slot_allocator_type  _slot_alloc;
+  skip_allocator_type  _skip_alloc;
+
+  // Groups
+
+  group* create_group(size_type capacity) {
+    group* g = _group_alloc.allocate(1);
+    try {
+      g->elements = _slot_alloc.allocate(capacity);
+    } catch (...) {
+      _group_alloc.deallocate(g, 1);
+      throw;
+    }
+    try {
+      g->skipfield = _skip_alloc.allocate(capacity + 1);
+    } catch (...) {
+      _slot_alloc.deallocate(g->elements, capacity);
+      _group_alloc.deallocate(g, 1);
+      throw;
+    }
+    for (size_type i = 0; i <= capacity; ++i)
+      g->skipfield[i] = 0;
+    g->prev = g->next = NULL;
+    g->prev_free = g->next_free = NULL;
+    g->capacity = capacity;
+    g->size = 0;
+    g->last = 0;
+    g->free_head = group::none;
+    return g;
+  }
+
+  void destroy_group(group* g) {
+    _skip_alloc.deallocate(g->skipfield, g->capacity + 1);
+    _slot_alloc.deallocate(g->elements, g->capacity);
+    _group_alloc.deallocate(g, 1);
+  }
+
+  void link_back(group* g) {
+    g->prev = _back;
+    if (_back)
+      _back->next = g;
+    else
+      _front = g;
+    _back = g;
+    _capacity += g->capacity;
+  }
+
+  void push_free_group(group* g) {
+    g->prev_free = NULL;
+    g->next_free = _free_groups;
+    if (_free_groups)
+      _free_groups->prev_free = g;
+    _free_groups = g;
+  }
+
+  void unlink_free_group(group* g) {
+    if (g->prev_free)
+      g->prev_free->next_free = g->next_free;
+    else
+      _free_groups = g->next_free;
+    if (g->next_free)
+      g->next_free->prev_free = g->prev_free;
+  }
+
+  // Unlinks and frees a group with no live elements left.
+  void remove_group(group* g) {
+    if (g->free_head != group::none)
+      unlink_free_group(g);
+    if (g->prev)
+      g->prev->next = g->next;
+    else
+      _front = g->next;
+    if (g->next)
+      g->next->prev = g->prev;
+    else
+      _back = g->prev;
+    _capacity -= g->capacity;
+    destroy_group(g);
+  }
+
+  // Free list of erased runs within a group
+
+  void push_run(group* g, size_type start) {
+    skip_type s = static_cast<skip_type>(start);
+    g->elements[start].links.prev = group::none;
+    g->elements[start].links.next = g->free_head;
+    if (g->free_head == group::none)
+      push_free_group(g);
+    else
+      g->elements[g->free_head].links.prev = s;
+    g->free_head = s;
+  }
+
+  // Takes the run with the given neighbours out of the free list.
+  void unlink_run(group* g, skip_type prev, skip_type next) {
+    if (prev != group::none)
+      g->elements[prev].links.next = next;
+    else
+      g->free_head = next;
+    if (next != group::none)
+      g->elements[next].links.prev = prev;
+    if (g->free_head == group::none)
+      unlink_free_group(g);
+  }
+
+  // Points the free list entry with the given neighbours at a run that
+  // now starts at slot to.
+  void move_run(group* g, skip_type prev, skip_type next, size_type to) {
+    skip_type s = static_cast<skip_type>(to);
+    g->elements[to].links.prev = prev;
+    g->elements[to].links.next = next;
+    if (prev != group::none)
+      g->elements[prev].links.next = s;
+    else
+      g->free_head = s;
+    if (next != group::none)
+      g->elements[next].links.prev = s;
+  }
+
+  // Construction into the first erased slot of a group with a free list,
+  // else the next unused slot of the last group, else a new group.
+  iterator insert_slot(const value_type& val) {
+    if (_free_groups) {
+      group* g = _free_groups;
+      size_type i = g->free_head;
+      skip_type prev = g->elements[i].links.prev;
+      skip_type next = g->elements[i].links.next;
+      try {
+        _alloc.construct(g->at(i), val);
+      } catch (...) {
+        g->elements[i].links.prev = prev;
+        g->elements[i].links.next = next;
+        throw;
+      }
+      skip_type run = g->skipfield[i];
+      if (run == 1) {
+        unlink_run(g, prev, next);
+      } else {
+        g->skipfield[i + 1] = g->skipfield[i + run - 1] = static_cast<skip_type>(run - 1);
+        move_run(g, prev, next, i + 1);
+      }
+      g->skipfield[i] = 0;
+      ++g->size;
+      return iterator(g, i);
+    }
+    if (!_back || _back->last == _back->capacity) {
+      size_type capacity = min_group_capacity;
+      if (_back)
+        capacity = _back->capacity * 2 < max_group_capacity ? _back->capacity * 2 : max_group_capacity;
+      group* g = create_group(capacity);
+      try {
+        _alloc.construct(g->at(0), val);
+      } catch (...) {
+        destroy_group(g);
+        throw;
+      }
+      link_back(g);
+      g->last = g->size = 1;
+      return iterator(g, 0);
+    }
+    _alloc.construct(_back->at(_back->last), val);
+    ++_back->size;
+    return iterator(_back, _back->last++);
+  }
+
+  // Records slot i as erased, merging it with the runs on either side.
+  void erase_slot(group* g, size_type i) {
+    skip_type* skip = g->skipfield;
+    size_type left = i ? skip[i - 1] : 0;
+    size_type right = skip[i + 1];
+    if (!left && !right) {
+      skip[i] = 1;
+      push_run(g, i);
+    } else if (!right) {
+      skip[i - left] = skip[i] = static_cast<skip_type>(left + 1);
+    } else {
+      skip_type length = static_cast<skip_type>(left + right + 1);
+      skip[i - left] = skip[i + right] = skip[i] = length;
+      skip_type prev = g->elements[i + 1].links.prev;
+      skip_type next = g->elements[i + 1].links.next;
+      if (left)
+        unlink_run(g, prev, next);
+      else
+        move_run(g, prev, next, i);
+    }
+  }
+
+  const_iterator group_begin(group* g) const {
+    return g ? const_iterator(g, g->skipfield[0]) : end();
+  }
+
+  void destroy_all() {
+    for (iterator it = begin(); it != end(); ++it)
+      _alloc.destroy(&*it);
+    while (_front) {
+      group* g = _front;
+      _front = g->next;
+      destroy_group(g);
+    }
+    _back = _free_groups = NULL;
+    _size = _capacity = 0;
+  }
+
+public:
+  // Constructors
+  explicit hive(const allocator_type& alloc = allocator_type())
+    : _front(NULL), _back(NULL), _free_groups(NULL), _size(0), _capacity(0),
+      _alloc(alloc), _group_alloc(alloc), _slot_alloc(alloc), _skip_alloc(alloc) {}
+
+  hive(size_type n, const value_type& val, const allocator_type& alloc = allocator_type())
+    : _front(NULL), _back(NULL), _free_groups(NULL), _size(0), _capacity(0),
+      _alloc(alloc), _group_alloc(alloc), _slot_alloc(alloc), _skip_alloc(alloc) {
+    try {
+      insert(n, val);
+    } catch (...) {
+      destroy_all();
+      throw;
+    }
+  }
+
+  template <class InputIterator>
+  hive(InputIterator first, InputIterator last,
+       const allocator_type& alloc = allocator_type(),
+       typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
+    : _front(NULL), _back(NULL), _free_groups(NULL), _size(0), _capacity(0),
+      _alloc(alloc), _group_alloc(alloc), _slot_alloc(alloc), _skip_alloc(alloc) {
+    try {
+      insert(first, last);
+    } catch (...) {
+      destroy_all();
+      throw;
+    }
+  }
+
+  hive(const hive& other)
+    : _front(NULL), _back(NULL), _free_groups(NULL), _size(0), _capacity(0),
+      _alloc(other._alloc), _group_alloc(other._alloc), _slot_alloc(other._alloc),
+      _skip_alloc(other._alloc) {
+    try {
+      insert(other.begin(), other.end());
+    } catch (...) {
+      destroy_all();
+      throw;
+    }
+  }
+
+  ~hive() { destroy_all(); }
+
+  hive& operator=(const hive& other) {
+    if (this != &other) {
+      hive tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  // Iterators
+  iterator begin() { return _front ? iterator(_front, _front->skipfield[0]) : end(); }
+  const_iterator begin() const { return group_begin(_front); }
+  iterator end() { return _back ? iterator(_back, _back->last) : iterator(); }
+  const_iterator end() const { return _back ? const_iterator(_back, _back->last) : const_iterator(); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  // Capacity
+  bool empty() const { return _size == 0; }
+  size_type size() const { return _size; }
+  size_type max_size() const { return _slot_alloc.max_size(); }
+  // Slots in all groups, live, erased or not used yet
+  size_type capacity() const { return _capacity; }
+  allocator_type get_allocator() const { return _alloc; }
+
+  // Modifiers
+  iterator insert(const value_type& val) {
+    iterator it = insert_slot(val);
+    ++_size;
+    return it;
+  }
+
+  void insert(size_type n, const value_type& val) {
+    for (; n; --n)
+      insert(val);
+  }
+
+  template <class InputIterator>
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+    for (; first != last; ++first)
+      insert(*first);
+  }
+
+  // Returns the element after pos in iteration order.
+  iterator erase(const_iterator pos) {
+    group* g = pos.group();
+    size_type i = pos.index();
+    _alloc.destroy(g->at(i));
+    --_size;
+    if (--g->size == 0) {
+      group* next = g->next;
+      group* prev = g->prev;
+      remove_group(g);
+      if (next)
+        return iterator(next, next->skipfield[0]);
+      return prev ? iterator(prev, prev->last) : iterator();
+    }
+    // The next live slot is past the run that starts at i + 1, if any
+    size_type next = i + 1 + g->skipfield[i + 1];
+    erase_slot(g, i);
+    if (next == g->last && g->next)
+      return iterator(g->next, g->next->skipfield[0]);
+    return iterator(g, next);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    // end() moves if the last group is freed; a live last keeps its group
+    if (last == end()) {
+      while (first != end())
+        first = erase(first);
+      return end();
+    }
+    while (first != last)
+      first = erase(first);
+    return iterator(last.group(), last.index());
+  }
+
+  void clear() { destroy_all(); }
+
+  void swap(hive& other) {
+    ft::swap(_front, other._front);
+    ft::swap(_back, other._back);
+    ft::swap(_free_groups, other._free_groups);
+    ft::swap(_size, other._size);
+    ft::swap(_capacity, other._capacity);
+    ft::swap(_alloc, other._alloc);
+    ft::swap(_group_alloc, other._group_alloc);
+    ft::swap(_slot_alloc, other._slot_alloc);
+    ft::swap(_skip_alloc, other._skip_alloc);
+  }
+
+  // Iterator to the element at p, which must be in this hive; end() if it
+  // is not. Takes O(number of groups).
+  iterator get_iterator(const_pointer p) {
+    const slot* s = reinterpret_cast<const slot*>(p);
+    std::less<const slot*> before;
+    for (group* g = _front; g; g = g->next)
+      if (!before(s, g->elements) && before(s, g->elements + g->last))
+        return iterator(g, s - g->elements);
+    return end();
+  }
+
+  const_iterator get_iterator(const_pointer p) const {
+    return const_cast<hive*>(this)->get_iterator(p);
+  }
+};
+
+template <typename T, typename Alloc>
+const typename hive<T, Alloc>::size_type hive<T, Alloc>::min_group_capacity;
+
+template <typename T, typename Alloc>
+const typename hive<T, Alloc>::size_type hive<T, Alloc>::max_group_capacity;
+
+template <typename T, typename Alloc>
+void swap(hive<T, Alloc>& x, hive<T, Alloc>& y) {
+  x.swap(y);
+}
+
+} // namespace ft
+
+#endif // FT_HIVE_HPP
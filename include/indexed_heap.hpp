@@ -0,0 +1,203 @@
+// Binary heap with a position index, so queued items can be re-prioritised
+// or removed in place (decrease-key) instead of the lazy-deletion trick
+// required by std::priority_queue.
+
+#ifndef FT_INDEXED_HEAP_HPP
+#define FT_INDEXED_HEAP_HPP
+
+#include <memory>
+#include <cstddef>
+#include <functional>
+#include "exception.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+// Max-heap with respect to Compare, like std::priority_queue: top() is the
+// element for which no other element compares greater.
+//
+// push() returns a handle that stays valid until that element is popped or
+// erased; handles of removed elements are recycled by later pushes.
+template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T> >
+class indexed_heap {
+public:
+  typedef T                                       value_type;
+  typedef Compare                                 value_compare;
+  typedef Alloc                                   allocator_type;
+  typedef typename allocator_type::reference      reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef std::size_t                             size_type;
+  typedef std::size_t                             handle_type;
+
+  static const size_type npos = static_cast<size_type>(-1);
+
+private:
+  typedef typename Alloc::template rebind<size_type>::other index_allocator_type;
+  typedef ft::vector<size_type, index_allocator_type>       index_vector;
+
+  ft::vector<value_type, allocator_type> _values; // value of each handle
+  index_vector   _heap;     // heap order -> handle
+  index_vector   _position; // handle -> heap order, npos if not queued
+  index_vector   _free;     // recycled handles
+  value_compare  _comp;
+
+  bool less(size_type a, size_type b) const {
+    return _comp(_values[_heap[a]], _values[_heap[b]]);
+  }
+
+  void place(size_type pos, handle_type h) {
+    _heap[pos] = h;
+    _position[h] = pos;
+  }
+
+  size_type sift_up(size_type pos) {
+    handle_type h = _heap[pos];
+    while (pos > 0) {
+      size_type parent = (pos - 1) / 2;
+      if (!_comp(_values[_heap[parent]], _values[h]))
+        break;
+      place(pos, _heap[parent]);
+      pos = parent;
+    }
+    place(pos, h);
+    return pos;
+  }
+
+  size_type sift_down(size_type pos) {
+    handle_type h = _heap[pos];
+    size_type n = _heap.size();
+    for (;;) {
+      size_type child = 2 * pos + 1;
+      if (child >= n)
+        break;
+      if (child + 1 < n && less(child, child + 1))
+        ++child;
+      if (!_comp(_values[h], _values[_heap[child]]))
+        break;
+      place(pos, _heap[child]);
+      pos = child;
+    }
+    place(pos, h);
+    return pos;
+  }
+
+  void restore(size_type pos) {
+    if (sift_up(pos) == pos)
+      sift_down(pos);
+  }
+
+  void check_handle(handle_type h, const char* what) const {
+    if (!contains(h))
+      throw ft::out_of_range(what);
+  }
+
+  // Detaches the element at heap position pos and recycles its handle.
+  void remove_at(size_type pos) {
+    handle_type h = _heap[pos];
+    size_type last = _heap.size() - 1;
+    if (pos != last)
+      place(pos, _heap[last]);
+    _heap.pop_back();
+    if (pos != last)
+      restore(pos);
+    _position[h] = npos;
+    _free.push_back(h);
+  }
+
+public:
+  explicit indexed_heap(const value_compare& comp = value_compare(),
+                        const allocator_type& alloc = allocator_type())
+    : _values(alloc), _heap(index_allocator_type(alloc)), _position(index_allocator_type(alloc)),
+      _free(index_allocator_type(alloc)), _comp(comp) {}
+
+  // Capacity
+  bool empty() const { return _heap.empty(); }
+  size_type size() const { return _heap.size(); }
+
+  void reserve(size_type n) {
+    _values.reserve(n);
+    _heap.reserve(n);
+    _position.reserve(n);
+  }
+
+  // Element access
+  const_reference top() const { return _values[_heap[0]]; }
+  handle_type top_handle() const { return _heap[0]; }
+
+  bool contains(handle_type h) const {
+    return h < _position.size() && _position[h] != npos;
+  }
+
+  const_reference operator[](handle_type h) const { return _values[h]; }
+
+  const_reference at(handle_type h) const {
+    check_handle(h, "indexed_heap::at");
+    return _values[h];
+  }
+
+  // Modifiers
+  handle_type push(const value_type& val) {
+    handle_type h;
+    if (!_free.empty()) {
+      h = _free.back();
+      _free.pop_back();
+      _values[h] = val;
+    } else {
+      h = _values.size();
+      _values.push_back(val);
+      _position.push_back(npos);
+    }
+    _heap.push_back(h);
+    sift_up(_heap.size() - 1);
+    return h;
+  }
+
+  void pop() {
+    remove_at(0);
+  }
+
+  // Replaces the priority of a queued element and restores heap order;
+  // works for both increase- and decrease-key.
+  void update(handle_type h, const value_type& val) {
+    check_handle(h, "indexed_heap::update");
+    _values[h] = val;
+    restore(_position[h]);
+  }
+
+  void erase(handle_type h) {
+    check_handle(h, "indexed_heap::erase");
+    remove_at(_position[h]);
+  }
+
+  void clear() {
+    _values.clear();
+    _heap.clear();
+    _position.clear();
+    _free.clear();
+  }
+
+  void swap(indexed_heap& other) {
+    _values.swap(other._values);
+    _heap.swap(other._heap);
+    _position.swap(other._position);
+    _free.swap(other._free);
+    ft::swap(_comp, other._comp);
+  }
+
+  value_compare value_comp() const { return _comp; }
+  allocator_type get_allocator() const { return _values.get_allocator(); }
+};
+
+template <typename T, typename Compare, typename Alloc>
+const typename indexed_heap<T, Compare, Alloc>::size_type
+  indexed_heap<T, Compare, Alloc>::npos;
+
+// Non-member swap
+template <typename T, typename Compare, typename Alloc>
+void swap(indexed_heap<T, Compare, Alloc>& x, indexed_heap<T, Compare, Alloc>& y) {
+  x.swap(y);
+}
+
+} // namespace ft
+
+#endif // FT_INDEXED_HEAP_HPP
@@ -0,0 +1,103 @@
+#ifndef HIVE_ITERATOR_HPP
+#define HIVE_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+#include "utils/hive_group.hpp"
+#include "utils/enable_if.hpp"
+#include "utils/is_convertible.hpp"
+
+namespace ft {
+
+// Bidirectional iterator over a hive: a group and a slot index. Stepping
+// reads the skipfield entry next to the current slot and jumps over the
+// whole erased run it starts (or ends, going backwards) at once.
+template <typename T, typename NonConstT>
+class hive_iterator {
+public:
+  typedef T                                value_type;
+  typedef value_type&                      reference;
+  typedef value_type*                      pointer;
+  typedef std::ptrdiff_t                   difference_type;
+  typedef std::bidirectional_iterator_tag  iterator_category;
+
+  typedef hive_group<NonConstT>            group_type;
+  typedef hive_iterator<T, NonConstT>      self_type;
+
+private:
+  group_type*  _group;
+  std::size_t  _index;
+
+public:
+  // Constructors
+  hive_iterator() : _group(NULL), _index(0) {}
+  hive_iterator(group_type* group, std::size_t index) : _group(group), _index(index) {}
+  hive_iterator(const self_type& other) : _group(other._group), _index(other._index) {}
+
+  // Conversion from iterator<U> to iterator<T>
+  template <typename U>
+  hive_iterator(const hive_iterator<U, NonConstT>& other,
+                typename ft::enable_if<ft::is_convertible<U*, T*>::value>::type* = 0)
+    : _group(other.group()), _index(other.index()) {}
+
+  // Assignment
+  self_type& operator=(const self_type& other) {
+    _group = other._group;
+    _index = other._index;
+    return *this;
+  }
+
+  // Dereference
+  reference operator*() const { return *_group->at(_index); }
+  pointer operator->() const { return _group->at(_index); }
+
+  // Navigation. Past the last used slot of a group that is not the last
+  // one, the walk continues at the next group's first live slot; groups
+  // are never empty, so that one jump is enough.
+  self_type& operator++() {
+    ++_index;
+    _index += _group->skipfield[_index];
+    if (_index == _group->last && _group->next) {
+      _group = _group->next;
+      _index = _group->skipfield[0];
+    }
+    return *this;
+  }
+
+  self_type operator++(int) { self_type tmp(*this); ++(*this); return tmp; }
+
+  self_type& operator--() {
+    for (;;) {
+      if (_index == 0) {
+        _group = _group->prev;
+        _index = _group->last;
+      }
+      std::size_t run = _group->skipfield[_index - 1];
+      if (run < _index) {
+        _index -= run + 1;
+        return *this;
+      }
+      _index = 0;
+    }
+  }
+
+  self_type operator--(int) { self_type tmp(*this); --(*this); return tmp; }
+
+  // Comparison
+  template <typename U>
+  bool operator==(const hive_iterator<U, NonConstT>& rhs) const {
+    return _index == rhs.index() && _group == rhs.group();
+  }
+
+  template <typename U>
+  bool operator!=(const hive_iterator<U, NonConstT>& rhs) const {
+    return !(*this == rhs);
+  }
+
+  group_type* group() const { return _group; }
+  std::size_t index() const { return _index; }
+};
+
+} // namespace ft
+
+#endif // HIVE_ITERATOR_HPP
@@ -33,6 +33,30 @@ struct iterator_traits<const T*> {
   typedef std::random_access_iterator_tag iterator_category;
 };
 
+namespace _iterator {
+
+template <class InputIt>
+typename iterator_traits<InputIt>::difference_type
+distance(InputIt first, InputIt last, std::input_iterator_tag) {
+  typename iterator_traits<InputIt>::difference_type n = 0;
+  for (; first != last; ++first)
+    ++n;
+  return n;
+}
+
+template <class RandomIt>
+typename iterator_traits<RandomIt>::difference_type
+distance(RandomIt first, RandomIt last, std::random_access_iterator_tag) {
+  return last - first;
+}
+
+} // namespace _iterator
+
+template <class InputIt>
+typename iterator_traits<InputIt>::difference_type distance(InputIt first, InputIt last) {
+  return _iterator::distance(first, last, typename iterator_traits<InputIt>::iterator_category());
+}
+
 } // namespace ft
 
 #endif // ITERATOR_TRAITS_HPP
@@ -16,6 +16,10 @@ public:
   typedef T&                               reference;
   typedef std::ptrdiff_t                   difference_type;
   typedef std::random_access_iterator_tag  iterator_category;
+#if __cplusplus >= 202002L
+  // Lets std::ranges algorithms and std::to_address treat it as a pointer
+  typedef std::contiguous_iterator_tag     iterator_concept;
+#endif
 
 private:
   pointer _ptr;
@@ -0,0 +1,119 @@
+#ifndef RING_BUFFER_ITERATOR_HPP
+# define RING_BUFFER_ITERATOR_HPP
+
+# include <iterator>
+# include <cstddef>
+# include "utils/enable_if.hpp"
+# include "utils/is_convertible.hpp"
+
+namespace ft {
+
+// Random access iterator over a power-of-two ring. The position is a
+// logical, ever-increasing index; the slot is found by masking it, so
+// arithmetic never has to care about the wrap point.
+template <typename T>
+class ring_buffer_iterator {
+public:
+  typedef T                                value_type;
+  typedef T*                               pointer;
+  typedef T&                               reference;
+  typedef std::ptrdiff_t                   difference_type;
+  typedef std::random_access_iterator_tag  iterator_category;
+
+private:
+  pointer     _data;
+  std::size_t _mask;
+  std::size_t _pos;
+
+public:
+  // Constructors
+  ring_buffer_iterator(): _data(0), _mask(0), _pos(0) {}
+  ring_buffer_iterator(pointer data, std::size_t mask, std::size_t pos)
+    : _data(data), _mask(mask), _pos(pos) {}
+  ring_buffer_iterator(const ring_buffer_iterator& other)
+    : _data(other._data), _mask(other._mask), _pos(other._pos) {}
+
+  // Conversion from iterator<U> to iterator<T> if U* is convertible to T*
+  template <typename U>
+  ring_buffer_iterator(const ring_buffer_iterator<U>& other,
+    typename ft::enable_if<ft::is_convertible<U*, T*>::value>::type* = 0)
+    : _data(other.data()), _mask(other.mask()), _pos(other.position()) {}
+
+  // Assignment
+  ring_buffer_iterator& operator=(const ring_buffer_iterator& other) {
+    if (this != &other) {
+      _data = other._data;
+      _mask = other._mask;
+      _pos = other._pos;
+    }
+    return *this;
+  }
+
+  // Access
+  reference operator*() const { return _data[_pos & _mask]; }
+  pointer operator->() const { return _data + (_pos & _mask); }
+  reference operator[](difference_type n) const { return _data[(_pos + n) & _mask]; }
+
+  // Increment / Decrement
+  ring_buffer_iterator& operator++() { ++_pos; return *this; }
+  ring_buffer_iterator operator++(int) { ring_buffer_iterator tmp(*this); ++_pos; return tmp; }
+  ring_buffer_iterator& operator--() { --_pos; return *this; }
+  ring_buffer_iterator operator--(int) { ring_buffer_iterator tmp(*this); --_pos; return tmp; }
+
+  // Arithmetic
+  ring_buffer_iterator operator+(difference_type n) const { return ring_buffer_iterator(_data, _mask, _pos + n); }
+  ring_buffer_iterator operator-(difference_type n) const { return ring_buffer_iterator(_data, _mask, _pos - n); }
+  difference_type operator-(const ring_buffer_iterator& rhs) const {
+    return static_cast<difference_type>(_pos - rhs._pos);
+  }
+  ring_buffer_iterator& operator+=(difference_type n) { _pos += n; return *this; }
+  ring_buffer_iterator& operator-=(difference_type n) { _pos -= n; return *this; }
+
+  // Getters
+  pointer data() const { return _data; }
+  std::size_t mask() const { return _mask; }
+  std::size_t position() const { return _pos; }
+};
+
+// Addition with int on the left
+template <typename T>
+ring_buffer_iterator<T> operator+(
+  typename ring_buffer_iterator<T>::difference_type n,
+  const ring_buffer_iterator<T>& it) {
+  return it + n;
+}
+
+// Comparison operators
+template <typename T, typename U>
+bool operator==(const ring_buffer_iterator<T>& lhs, const ring_buffer_iterator<U>& rhs) {
+  return lhs.position() == rhs.position();
+}
+
+template <typename T, typename U>
+bool operator!=(const ring_buffer_iterator<T>& lhs, const ring_buffer_iterator<U>& rhs) {
+  return lhs.position() != rhs.position();
+}
+
+template <typename T, typename U>
+bool operator<(const ring_buffer_iterator<T>& lhs, const ring_buffer_iterator<U>& rhs) {
+  return static_cast<std::ptrdiff_t>(lhs.position() - rhs.position()) < 0;
+}
+
+template <typename T, typename U>
+bool operator<=(const ring_buffer_iterator<T>& lhs, const ring_buffer_iterator<U>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, typename U>
+bool operator>(const ring_buffer_iterator<T>& lhs, const ring_buffer_iterator<U>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, typename U>
+bool operator>=(const ring_buffer_iterator<T>& lhs, const ring_buffer_iterator<U>& rhs) {
+  return !(lhs < rhs);
+}
+
+} // namespace ft
+
+#endif // RING_BUFFER_ITERATOR_HPP
@@ -0,0 +1,66 @@
+// Iterator unwrapping, after libstdc++'s __niter_base. unwrap() turns an
+// ft::vector iterator into the pointer it wraps, and an ft::reverse_iterator
+// over one into a reverse_iterator over that pointer, so an algorithm can
+// run on raw pointers, where the standard library's memmove and memcmp
+// paths apply. rewrap() maps the pointer the algorithm returns back to the
+// caller's iterator type. Any other iterator passes through unchanged.
+
+#ifndef FT_UNWRAP_HPP
+#define FT_UNWRAP_HPP
+
+#include "iterators/random_access_iterator.hpp"
+#include "iterators/reverse_iterator.hpp"
+
+namespace ft {
+
+template <typename It>
+struct iterator_unwrapper {
+  static const bool contiguous = false;
+  typedef It type;
+  static type unwrap(const It& it) { return it; }
+  static It rewrap(const It&, const type& raw) { return raw; }
+};
+
+template <typename T>
+struct iterator_unwrapper<T*> {
+  static const bool contiguous = true;
+  typedef T* type;
+  static type unwrap(T* it) { return it; }
+  static T* rewrap(T*, T* raw) { return raw; }
+};
+
+template <typename T>
+struct iterator_unwrapper<ft::random_access_iterator<T> > {
+  static const bool contiguous = true;
+  typedef T* type;
+  static type unwrap(const ft::random_access_iterator<T>& it) { return it.base(); }
+  static ft::random_access_iterator<T> rewrap(const ft::random_access_iterator<T>&, T* raw) {
+    return ft::random_access_iterator<T>(raw);
+  }
+};
+
+template <typename It>
+struct iterator_unwrapper<ft::reverse_iterator<It> > {
+  typedef iterator_unwrapper<It> inner;
+
+  static const bool contiguous = false;
+  typedef ft::reverse_iterator<typename inner::type> type;
+  static type unwrap(const ft::reverse_iterator<It>& it) { return type(inner::unwrap(it.base())); }
+  static ft::reverse_iterator<It> rewrap(const ft::reverse_iterator<It>& it, const type& raw) {
+    return ft::reverse_iterator<It>(inner::rewrap(it.base(), raw.base()));
+  }
+};
+
+template <typename It>
+typename iterator_unwrapper<It>::type unwrap(const It& it) {
+  return iterator_unwrapper<It>::unwrap(it);
+}
+
+template <typename It>
+It rewrap(const It& it, const typename iterator_unwrapper<It>::type& raw) {
+  return iterator_unwrapper<It>::rewrap(it, raw);
+}
+
+} // namespace ft
+
+#endif // FT_UNWRAP_HPP
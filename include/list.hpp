@@ -31,7 +31,7 @@ public:
 
 private:
   typedef list_node<T>              node_type;
-  typedef std::allocator<node_type> node_allocator_type;
+  typedef typename Alloc::template rebind<node_type>::other node_allocator_type;
 
   node_type*       _head;
   node_type*       _tail;
@@ -60,13 +60,13 @@ private:
 
 public:
   explicit list(const allocator_type& alloc = allocator_type())
-    : _alloc(alloc) {
+    : _alloc(alloc), _node_alloc(alloc) {
     init_empty();
   }
 
   list(size_type n, const value_type& val = value_type(),
        const allocator_type& alloc = allocator_type())
-    : _alloc(alloc) {
+    : _alloc(alloc), _node_alloc(alloc) {
     init_empty();
     insert(begin(), n, val);
   }
@@ -75,12 +75,12 @@ public:
   list(InputIterator first, InputIterator last,
        const allocator_type& alloc = allocator_type(),
        typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
-    : _alloc(alloc) {
+    : _alloc(alloc), _node_alloc(alloc) {
     init_empty();
     insert(begin(), first, last);
   }
 
-  list(const list& other) : _alloc(other._alloc) {
+  list(const list& other) : _alloc(other._alloc), _node_alloc(other._node_alloc) {
     init_empty();
     insert(begin(), other.begin(), other.end());
   }
@@ -160,10 +160,35 @@ public:
   template <class InputIterator>
   void insert(iterator pos, InputIterator first, InputIterator last,
               typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
-    list tmp;
-    for (; first != last; ++first)
-      tmp.push_back(*first);
-    splice(pos, tmp);
+    if (first == last)
+      return;
+    // Build a detached chain, then link it in one step: no temporary list,
+    // no sentinels, and no walk to count what was spliced.
+    node_type* head = create_node(*first);
+    node_type* tail = head;
+    size_type n = 1;
+    try {
+      for (++first; first != last; ++first, ++n) {
+        node_type* node = create_node(*first);
+        tail->next = node;
+        node->prev = tail;
+        tail = node;
+      }
+    } catch (...) {
+      while (head) {
+        node_type* next = head->next;
+        destroy_node(head);
+        head = next;
+      }
+      throw;
+    }
+    node_type* after = pos.base();
+    node_type* before = after->prev;
+    before->next = head;
+    head->prev = before;
+    tail->next = after;
+    after->prev = tail;
+    _size += n;
   }
 
   iterator erase(iterator pos) {
@@ -196,6 +221,7 @@ public:
     ft::swap(_tail, other._tail);
     ft::swap(_size, other._size);
     ft::swap(_alloc, other._alloc);
+    ft::swap(_node_alloc, other._node_alloc);
   }
 
   void assign(size_type n, const value_type& val) {
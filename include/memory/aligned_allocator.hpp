@@ -0,0 +1,134 @@
+// Allocator whose blocks start on an Align-byte boundary: 32 for AVX2
+// loads, 64 for a cache line. Containers rebind it, so deque blocks and
+// list nodes get the same alignment as vector buffers.
+//
+// cache_padded<T> is the padding mode: each value fills whole cache lines,
+// so a vector of them aligned to ft::cache_line_size gives every thread a
+// slot no other slot shares a line with.
+
+#ifndef FT_ALIGNED_ALLOCATOR_HPP
+#define FT_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <limits>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+#include "utils/cache_line.hpp"
+
+#if __cplusplus >= 201103L
+# define FT_CACHE_PADDED_ALIGN alignas(ft::cache_line_size)
+#else
+# define FT_CACHE_PADDED_ALIGN
+#endif
+
+namespace ft {
+
+namespace _aligned {
+
+// Fails to compile unless Align is a power of two no smaller than a pointer.
+template <std::size_t Align, bool Valid = (Align >= sizeof(void*) && (Align & (Align - 1)) == 0)>
+struct check_alignment;
+
+template <std::size_t Align>
+struct check_alignment<Align, true> {};
+
+// Over-allocates by Align bytes and keeps the pointer operator new returned
+// in the word just below the aligned block.
+inline void* allocate(std::size_t bytes, std::size_t align) {
+  if (bytes > std::numeric_limits<std::size_t>::max() - align)
+    throw std::bad_alloc();
+  char* raw = static_cast<char*>(::operator new(bytes + align));
+  std::size_t address = reinterpret_cast<std::size_t>(raw + sizeof(void*));
+  char* aligned = raw + sizeof(void*) + (align - address % align) % align;
+  reinterpret_cast<void**>(aligned)[-1] = raw;
+  return aligned;
+}
+
+inline void deallocate(void* p) {
+  if (p)
+    ::operator delete(static_cast<void**>(p)[-1]);
+}
+
+} // namespace _aligned
+
+template <typename T, std::size_t Align = ft::cache_line_size>
+class aligned_allocator : private _aligned::check_alignment<Align> {
+public:
+  typedef T              value_type;
+  typedef T*             pointer;
+  typedef const T*       const_pointer;
+  typedef T&             reference;
+  typedef const T&       const_reference;
+  typedef std::size_t    size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind { typedef aligned_allocator<U, Align> other; };
+
+  static const size_type alignment = Align;
+
+  aligned_allocator() {}
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Align>&) {}
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  size_type max_size() const { return (std::numeric_limits<size_type>::max() - Align) / sizeof(T); }
+
+  void construct(pointer p, const_reference val) { ::new (static_cast<void*>(p)) T(val); }
+#if __cplusplus >= 201103L
+  void construct(pointer p, T&& val) { ::new (static_cast<void*>(p)) T(std::move(val)); }
+#endif
+  void destroy(pointer p) { p->~T(); }
+
+  pointer allocate(size_type n, const void* = 0) {
+    if (n > max_size())
+      throw std::bad_alloc();
+    return static_cast<pointer>(_aligned::allocate(n * sizeof(T), Align));
+  }
+
+  void deallocate(pointer p, size_type) { _aligned::deallocate(p); }
+};
+
+template <typename T, std::size_t Align>
+const typename aligned_allocator<T, Align>::size_type aligned_allocator<T, Align>::alignment;
+
+template <typename T, typename U, std::size_t Align>
+bool operator==(const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&) {
+  return true;
+}
+
+template <typename T, typename U, std::size_t Align>
+bool operator!=(const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&) {
+  return false;
+}
+
+// A T followed by enough padding to fill a whole number of cache lines.
+// C++11 pads through alignas; C++98 appends the bytes itself, a whole
+// extra line when sizeof(T) is already a multiple of one.
+template <typename T>
+struct FT_CACHE_PADDED_ALIGN cache_padded {
+  T value;
+
+  cache_padded() : value() {}
+  cache_padded(const T& val) : value(val) {}
+
+  T& operator*() { return value; }
+  const T& operator*() const { return value; }
+  T* operator->() { return &value; }
+  const T* operator->() const { return &value; }
+
+#if __cplusplus < 201103L
+private:
+  char _pad[ft::cache_line_size - sizeof(T) % ft::cache_line_size];
+#endif
+};
+
+} // namespace ft
+
+#undef FT_CACHE_PADDED_ALIGN
+
+#endif // FT_ALIGNED_ALLOCATOR_HPP
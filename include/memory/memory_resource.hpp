@@ -0,0 +1,84 @@
+// Polymorphic source of raw memory, after std::pmr::memory_resource. A
+// container picks the resource at run time through ft::arena_allocator
+// instead of through its allocator type.
+
+#ifndef FT_MEMORY_RESOURCE_HPP
+#define FT_MEMORY_RESOURCE_HPP
+
+#include <cstddef>
+#include <new>
+#include "memory/aligned_allocator.hpp"
+
+namespace ft {
+
+// Alignment operator new guarantees on the supported 64-bit targets.
+static const std::size_t max_align = 16;
+
+template <typename T>
+struct alignment_of {
+private:
+  struct probe { char c; T value; };
+
+public:
+  static const std::size_t value = sizeof(probe) - sizeof(T);
+};
+
+class memory_resource {
+public:
+  virtual ~memory_resource() {}
+
+  void* allocate(std::size_t bytes, std::size_t align = max_align) {
+    return do_allocate(bytes, align);
+  }
+
+  void deallocate(void* p, std::size_t bytes, std::size_t align = max_align) {
+    do_deallocate(p, bytes, align);
+  }
+
+  bool is_equal(const memory_resource& other) const { return do_is_equal(other); }
+
+protected:
+  virtual void* do_allocate(std::size_t bytes, std::size_t align) = 0;
+  virtual void do_deallocate(void* p, std::size_t bytes, std::size_t align) = 0;
+  virtual bool do_is_equal(const memory_resource& other) const = 0;
+};
+
+inline bool operator==(const memory_resource& x, const memory_resource& y) {
+  return &x == &y || x.is_equal(y);
+}
+
+inline bool operator!=(const memory_resource& x, const memory_resource& y) {
+  return !(x == y);
+}
+
+namespace _memory {
+
+class new_delete_resource : public memory_resource {
+protected:
+  void* do_allocate(std::size_t bytes, std::size_t align) {
+    if (align <= max_align)
+      return ::operator new(bytes);
+    return _aligned::allocate(bytes, align);
+  }
+
+  void do_deallocate(void* p, std::size_t, std::size_t align) {
+    if (align <= max_align)
+      ::operator delete(p);
+    else
+      _aligned::deallocate(p);
+  }
+
+  bool do_is_equal(const memory_resource& other) const { return this == &other; }
+};
+
+} // namespace _memory
+
+// Process-wide resource backed by operator new and delete.
+inline memory_resource* new_delete_resource() {
+  static _memory::new_delete_resource resource;
+  return &resource;
+}
+
+} // namespace ft
+
+#endif // FT_MEMORY_RESOURCE_HPP
@@ -0,0 +1,189 @@
+// Allocator for very large buffers. Blocks of at least Threshold bytes are
+// mapped straight from the kernel, advised onto transparent huge pages once
+// they reach 2 MiB, and resized with mremap, which moves page tables
+// instead of copying. Smaller blocks come from operator new. On systems
+// without mremap every block comes from operator new.
+//
+// ft::vector uses reallocate when its elements are trivially relocatable,
+// so growing a mapped buffer does not copy it.
+
+#ifndef FT_MMAP_ALLOCATOR_HPP
+#define FT_MMAP_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <limits>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+#include "utils/relocation.hpp"
+
+#if defined(__linux__)
+# include <sys/mman.h>
+# include <unistd.h>
+# define FT_MMAP_MREMAP 1
+#else
+# define FT_MMAP_MREMAP 0
+#endif
+
+namespace ft {
+
+namespace _mmap {
+
+static const std::size_t huge_page_size = std::size_t(2) << 20;
+
+inline std::size_t page_size() {
+#if FT_MMAP_MREMAP
+  static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+#else
+  return 4096;
+#endif
+}
+
+inline std::size_t round_to_pages(std::size_t bytes) {
+  std::size_t page = page_size();
+  return (bytes + page - 1) / page * page;
+}
+
+inline void advise_huge(void* p, std::size_t bytes) {
+#if FT_MMAP_MREMAP && defined(MADV_HUGEPAGE)
+  if (bytes >= huge_page_size)
+    madvise(p, bytes, MADV_HUGEPAGE);
+#else
+  (void)p;
+  (void)bytes;
+#endif
+}
+
+inline void* map(std::size_t bytes) {
+#if FT_MMAP_MREMAP
+  std::size_t length = round_to_pages(bytes);
+  void* p = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED)
+    throw std::bad_alloc();
+  advise_huge(p, length);
+  return p;
+#else
+  return ::operator new(bytes);
+#endif
+}
+
+inline void unmap(void* p, std::size_t bytes) {
+#if FT_MMAP_MREMAP
+  munmap(p, round_to_pages(bytes));
+#else
+  (void)bytes;
+  ::operator delete(p);
+#endif
+}
+
+inline void* remap(void* p, std::size_t old_bytes, std::size_t new_bytes) {
+#if FT_MMAP_MREMAP
+  std::size_t old_length = round_to_pages(old_bytes);
+  std::size_t new_length = round_to_pages(new_bytes);
+  if (old_length == new_length)
+    return p;
+  void* q = mremap(p, old_length, new_length, MREMAP_MAYMOVE);
+  if (q == MAP_FAILED)
+    throw std::bad_alloc();
+  advise_huge(q, new_length);
+  return q;
+#else
+  (void)p;
+  (void)old_bytes;
+  (void)new_bytes;
+  return NULL;
+#endif
+}
+
+} // namespace _mmap
+
+template <typename T, std::size_t Threshold = (std::size_t(1) << 20)>
+class mmap_allocator {
+public:
+  typedef T              value_type;
+  typedef T*             pointer;
+  typedef const T*       const_pointer;
+  typedef T&             reference;
+  typedef const T&       const_reference;
+  typedef std::size_t    size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind { typedef mmap_allocator<U, Threshold> other; };
+
+  static const size_type map_threshold = Threshold;
+
+  mmap_allocator() {}
+  template <typename U>
+  mmap_allocator(const mmap_allocator<U, Threshold>&) {}
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+  void construct(pointer p, const_reference val) { ::new (static_cast<void*>(p)) T(val); }
+#if __cplusplus >= 201103L
+  void construct(pointer p, T&& val) { ::new (static_cast<void*>(p)) T(std::move(val)); }
+#endif
+  void destroy(pointer p) { p->~T(); }
+
+  pointer allocate(size_type n, const void* = 0) {
+    if (n > max_size())
+      throw std::bad_alloc();
+    if (!mapped(n))
+      return static_cast<pointer>(::operator new(n * sizeof(T)));
+    return static_cast<pointer>(_mmap::map(n * sizeof(T)));
+  }
+
+  void deallocate(pointer p, size_type n) {
+    if (!p)
+      return;
+    if (mapped(n))
+      _mmap::unmap(p, n * sizeof(T));
+    else
+      ::operator delete(p);
+  }
+
+  // Mapped to mapped goes through mremap; any other pair of sizes
+  // allocates, copies the bytes and frees.
+  pointer reallocate(pointer p, size_type old_n, size_type new_n) {
+    if (mapped(old_n) && mapped(new_n))
+      return static_cast<pointer>(_mmap::remap(p, old_n * sizeof(T), new_n * sizeof(T)));
+    pointer q = allocate(new_n);
+    std::memcpy(static_cast<void*>(q), static_cast<const void*>(p),
+                (old_n < new_n ? old_n : new_n) * sizeof(T));
+    deallocate(p, old_n);
+    return q;
+  }
+
+private:
+  static bool mapped(size_type n) { return FT_MMAP_MREMAP && n * sizeof(T) >= Threshold; }
+};
+
+template <typename T, std::size_t Threshold>
+const typename mmap_allocator<T, Threshold>::size_type mmap_allocator<T, Threshold>::map_threshold;
+
+template <typename T, typename U, std::size_t Threshold>
+bool operator==(const mmap_allocator<T, Threshold>&, const mmap_allocator<U, Threshold>&) {
+  return true;
+}
+
+template <typename T, typename U, std::size_t Threshold>
+bool operator!=(const mmap_allocator<T, Threshold>&, const mmap_allocator<U, Threshold>&) {
+  return false;
+}
+
+template <typename T, std::size_t Threshold>
+struct allocator_reallocates<mmap_allocator<T, Threshold> > {
+  static const bool value = true;
+};
+
+} // namespace ft
+
+#undef FT_MMAP_MREMAP
+
+#endif // FT_MMAP_ALLOCATOR_HPP
@@ -0,0 +1,188 @@
+// Bump allocator for objects that all die together. Allocation advances a
+// pointer through the current chunk; deallocation does nothing; release()
+// hands every chunk back to the upstream resource at once. The first chunk
+// can be a caller-provided buffer, typically on the stack, so a request
+// that fits in it never touches the heap.
+//
+//   char buffer[4096];
+//   ft::monotonic_arena arena(buffer, sizeof(buffer));
+//   ft::vector<int, ft::arena_allocator<int> > v(&arena);
+//   ...
+//   arena.release();  // after every container using it is gone
+
+#ifndef FT_MONOTONIC_ARENA_HPP
+#define FT_MONOTONIC_ARENA_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+#include "memory/memory_resource.hpp"
+
+namespace ft {
+
+class monotonic_arena : public memory_resource {
+public:
+  explicit monotonic_arena(std::size_t initial_size = 1024,
+                           memory_resource* upstream = new_delete_resource())
+    : _upstream(upstream), _buffer(NULL), _buffer_size(0), _chunks(NULL),
+      _initial_size(initial_size ? initial_size : 1) {
+    reset();
+  }
+
+  monotonic_arena(void* buffer, std::size_t size,
+                  memory_resource* upstream = new_delete_resource())
+    : _upstream(upstream), _buffer(static_cast<char*>(buffer)), _buffer_size(size),
+      _chunks(NULL), _initial_size(size ? size : 1) {
+    reset();
+  }
+
+  ~monotonic_arena() { release(); }
+
+  // Frees every chunk and starts over from the initial buffer. Anything
+  // allocated from the arena is gone afterwards.
+  void release() {
+    while (_chunks) {
+      chunk* next = _chunks->next;
+      _upstream->deallocate(_chunks, _chunks->size);
+      _chunks = next;
+    }
+    reset();
+  }
+
+  memory_resource* upstream() const { return _upstream; }
+
+protected:
+  void* do_allocate(std::size_t bytes, std::size_t align) {
+    void* p = bump(bytes, align);
+    if (!p) {
+      grow(bytes, align);
+      p = bump(bytes, align);
+    }
+    return p;
+  }
+
+  void do_deallocate(void*, std::size_t, std::size_t) {}
+
+  bool do_is_equal(const memory_resource& other) const { return this == &other; }
+
+private:
+  // Chunks are chained through a header at their start, which keeps the
+  // payload max_align aligned.
+  struct chunk {
+    chunk*      next;
+    std::size_t size;
+  };
+  static const std::size_t header_size = (sizeof(chunk) + max_align - 1) / max_align * max_align;
+
+  memory_resource* _upstream;
+  char*            _buffer;
+  std::size_t      _buffer_size;
+  chunk*           _chunks;
+  char*            _current;
+  char*            _end;
+  std::size_t      _initial_size;
+  std::size_t      _next_size;
+
+  monotonic_arena(const monotonic_arena&);
+  monotonic_arena& operator=(const monotonic_arena&);
+
+  void reset() {
+    _current = _buffer;
+    _end = _buffer + _buffer_size;
+    _next_size = _initial_size;
+  }
+
+  void* bump(std::size_t bytes, std::size_t align) {
+    std::size_t space = static_cast<std::size_t>(_end - _current);
+    std::size_t skip = (align - reinterpret_cast<std::size_t>(_current) % align) % align;
+    if (!_current || skip > space || bytes > space - skip)
+      return NULL;
+    void* p = _current + skip;
+    _current += skip + bytes;
+    return p;
+  }
+
+  // Each chunk is twice the last, and always big enough for this request.
+  void grow(std::size_t bytes, std::size_t align) {
+    std::size_t limit = std::numeric_limits<std::size_t>::max() / 2 - header_size;
+    if (bytes > limit || align > limit - bytes)
+      throw std::bad_alloc();
+    std::size_t size = header_size + bytes + (align > max_align ? align : 0);
+    if (size < _next_size)
+      size = _next_size;
+    chunk* c = static_cast<chunk*>(_upstream->allocate(size));
+    c->next = _chunks;
+    c->size = size;
+    _chunks = c;
+    _current = reinterpret_cast<char*>(c) + header_size;
+    _end = reinterpret_cast<char*>(c) + size;
+    _next_size = size < limit ? size * 2 : size;
+  }
+};
+
+// Allocator adapter over a memory_resource, usually a monotonic_arena.
+// Rebound copies share the resource, so list nodes and deque maps and
+// blocks come from the same arena as the elements. Default-constructed, it
+// uses new_delete_resource().
+template <typename T>
+class arena_allocator {
+public:
+  typedef T              value_type;
+  typedef T*             pointer;
+  typedef const T*       const_pointer;
+  typedef T&             reference;
+  typedef const T&       const_reference;
+  typedef std::size_t    size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind { typedef arena_allocator<U> other; };
+
+  arena_allocator() : _resource(new_delete_resource()) {}
+  arena_allocator(memory_resource* resource) : _resource(resource) {}
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& other) : _resource(other.resource()) {}
+
+  memory_resource* resource() const { return _resource; }
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+  void construct(pointer p, const_reference val) { ::new (static_cast<void*>(p)) T(val); }
+#if __cplusplus >= 201103L
+  void construct(pointer p, T&& val) { ::new (static_cast<void*>(p)) T(std::move(val)); }
+#endif
+  void destroy(pointer p) { p->~T(); }
+
+  pointer allocate(size_type n, const void* = 0) {
+    if (n > max_size())
+      throw std::bad_alloc();
+    return static_cast<pointer>(_resource->allocate(n * sizeof(T), alignment_of<T>::value));
+  }
+
+  void deallocate(pointer p, size_type n) {
+    _resource->deallocate(p, n * sizeof(T), alignment_of<T>::value);
+  }
+
+private:
+  memory_resource* _resource;
+};
+
+template <typename T, typename U>
+bool operator==(const arena_allocator<T>& x, const arena_allocator<U>& y) {
+  return *x.resource() == *y.resource();
+}
+
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T>& x, const arena_allocator<U>& y) {
+  return !(x == y);
+}
+
+} // namespace ft
+
+#endif // FT_MONOTONIC_ARENA_HPP
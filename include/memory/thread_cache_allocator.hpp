@@ -0,0 +1,253 @@
+// Allocator that serves small blocks from a per-thread cache, after
+// tcmalloc. Requires C++11 (thread_local, std::mutex).
+//
+// Requests up to 4 KiB are rounded to a power-of-two size class. Each
+// thread keeps a free list per class and touches no shared state while the
+// list has blocks. An empty list takes a whole batch from the shared depot
+// (or a fresh slab from operator new); a list holding two batches gives
+// one back. Blocks carry no owner, so a block freed on another thread
+// simply joins that thread's cache: producer/consumer churn flows back to
+// the producer through the depot one batch, and one lock, at a time.
+//
+// Slabs are kept for the life of the process. Larger requests go straight
+// to operator new. Types aligned beyond the 16 bytes a slab block
+// guarantees bypass the cache and get a block from ft::aligned_allocator's
+// helpers instead.
+
+#ifndef FT_THREAD_CACHE_ALLOCATOR_HPP
+#define FT_THREAD_CACHE_ALLOCATOR_HPP
+
+#if __cplusplus < 201103L
+# error "memory/thread_cache_allocator.hpp requires C++11"
+#endif
+
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#include "memory/aligned_allocator.hpp"
+
+namespace ft {
+
+namespace _thread_cache {
+
+static const std::size_t min_size = 16;
+static const std::size_t max_size = 4096;
+static const std::size_t class_count = 9;
+static const std::size_t slab_bytes = 32 * 1024;
+
+// Slabs come from operator new and every class size is a multiple of
+// min_size, so each block is aligned to this much.
+static const std::size_t block_align = min_size;
+
+inline std::size_t class_of(std::size_t bytes) {
+  std::size_t c = 0;
+  for (std::size_t size = min_size; size < bytes; size <<= 1)
+    ++c;
+  return c;
+}
+
+inline std::size_t class_size(std::size_t c) { return min_size << c; }
+
+// Blocks moved between a thread and the depot at once: 64 small blocks,
+// down to 8 of the largest.
+inline std::size_t batch_size(std::size_t c) {
+  std::size_t n = slab_bytes / class_size(c);
+  return n > 64 ? 64 : n;
+}
+
+struct free_block {
+  free_block* next;
+};
+
+struct chain {
+  free_block* head;
+  std::size_t count;
+};
+
+class depot {
+public:
+  ~depot() {
+    for (std::size_t c = 0; c < class_count; ++c)
+      for (std::size_t i = 0; i < _classes[c].slabs.size(); ++i)
+        ::operator delete(_classes[c].slabs[i]);
+  }
+
+  // A batch returned by some thread, or a freshly carved slab.
+  chain take(std::size_t c) {
+    shelf& s = _classes[c];
+    {
+      std::lock_guard<std::mutex> guard(s.lock);
+      if (!s.chains.empty()) {
+        chain batch = s.chains.back();
+        s.chains.pop_back();
+        return batch;
+      }
+    }
+    std::size_t size = class_size(c);
+    std::size_t count = batch_size(c);
+    char* slab = static_cast<char*>(::operator new(size * count));
+    for (std::size_t i = 0; i + 1 < count; ++i)
+      reinterpret_cast<free_block*>(slab + i * size)->next =
+          reinterpret_cast<free_block*>(slab + (i + 1) * size);
+    reinterpret_cast<free_block*>(slab + (count - 1) * size)->next = NULL;
+    {
+      std::lock_guard<std::mutex> guard(s.lock);
+      s.slabs.push_back(slab);
+    }
+    chain batch = { reinterpret_cast<free_block*>(slab), count };
+    return batch;
+  }
+
+  void give(std::size_t c, chain batch) {
+    shelf& s = _classes[c];
+    std::lock_guard<std::mutex> guard(s.lock);
+    s.chains.push_back(batch);
+  }
+
+private:
+  struct shelf {
+    std::mutex          lock;
+    std::vector<chain>  chains;
+    std::vector<void*>  slabs;
+  };
+
+  shelf _classes[class_count];
+};
+
+inline depot& shared_depot() {
+  static depot instance;
+  return instance;
+}
+
+class thread_cache {
+public:
+  // Touching the depot first makes it outlive every thread's cache,
+  // including the main thread's.
+  thread_cache() {
+    shared_depot();
+    for (std::size_t c = 0; c < class_count; ++c) {
+      _lists[c].head = NULL;
+      _lists[c].count = 0;
+    }
+  }
+
+  ~thread_cache() {
+    for (std::size_t c = 0; c < class_count; ++c)
+      if (_lists[c].head)
+        shared_depot().give(c, _lists[c]);
+  }
+
+  void* allocate(std::size_t c) {
+    chain& list = _lists[c];
+    if (!list.head)
+      list = shared_depot().take(c);
+    free_block* block = list.head;
+    list.head = block->next;
+    --list.count;
+    return block;
+  }
+
+  void deallocate(void* p, std::size_t c) {
+    chain& list = _lists[c];
+    free_block* block = static_cast<free_block*>(p);
+    block->next = list.head;
+    list.head = block;
+    if (++list.count >= 2 * batch_size(c))
+      flush(c);
+  }
+
+private:
+  chain _lists[class_count];
+
+  // Hands the first batch of the list to the depot.
+  void flush(std::size_t c) {
+    chain& list = _lists[c];
+    chain batch = { list.head, batch_size(c) };
+    free_block* last = list.head;
+    for (std::size_t i = 1; i < batch.count; ++i)
+      last = last->next;
+    list.head = last->next;
+    list.count -= batch.count;
+    last->next = NULL;
+    shared_depot().give(c, batch);
+  }
+};
+
+inline thread_cache& local_cache() {
+  static thread_local thread_cache cache;
+  return cache;
+}
+
+} // namespace _thread_cache
+
+template <typename T>
+class thread_cache_allocator {
+private:
+  // Types aligned beyond the slab blocks never use the cache
+  static const bool over_aligned = alignof(T) > _thread_cache::block_align;
+
+public:
+  typedef T              value_type;
+  typedef T*             pointer;
+  typedef const T*       const_pointer;
+  typedef T&             reference;
+  typedef const T&       const_reference;
+  typedef std::size_t    size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind { typedef thread_cache_allocator<U> other; };
+
+  thread_cache_allocator() {}
+  template <typename U>
+  thread_cache_allocator(const thread_cache_allocator<U>&) {}
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+  void construct(pointer p, const_reference val) { ::new (static_cast<void*>(p)) T(val); }
+  void construct(pointer p, T&& val) { ::new (static_cast<void*>(p)) T(std::move(val)); }
+  void destroy(pointer p) { p->~T(); }
+
+  pointer allocate(size_type n, const void* = 0) {
+    if (n > max_size())
+      throw std::bad_alloc();
+    std::size_t bytes = n * sizeof(T);
+    if (over_aligned)
+      return static_cast<pointer>(_aligned::allocate(bytes, alignof(T)));
+    if (bytes > _thread_cache::max_size)
+      return static_cast<pointer>(::operator new(bytes));
+    return static_cast<pointer>(_thread_cache::local_cache().allocate(_thread_cache::class_of(bytes)));
+  }
+
+  void deallocate(pointer p, size_type n) {
+    if (!p)
+      return;
+    std::size_t bytes = n * sizeof(T);
+    if (over_aligned)
+      _aligned::deallocate(p);
+    else if (bytes > _thread_cache::max_size)
+      ::operator delete(p);
+    else
+      _thread_cache::local_cache().deallocate(p, _thread_cache::class_of(bytes));
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) {
+  return false;
+}
+
+} // namespace ft
+
+#endif // FT_THREAD_CACHE_ALLOCATOR_HPP
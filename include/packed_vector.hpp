@@ -0,0 +1,415 @@
+// Append-only vector of integers stored in as few bits as the values need.
+// Values are packed in blocks of 128. Each block is encoded at its own
+// width, recorded in a per-block index next to the block's word offset, so
+// element i is found in constant time. The encoding is a policy:
+//
+//   ft::fixed_width         each value in the bits its block's largest value
+//                           needs (signed values zigzag-encoded, so small
+//                           negatives stay small)
+//   ft::frame_of_reference  each value as its distance from the block's
+//                           minimum, which suits sorted or clustered data
+//
+// The last, partial block is kept unpacked until it fills. Reading is
+// through operator[] or a sequential iterator that unpacks a whole block
+// at a time, with AVX2 where available.
+
+#ifndef FT_PACKED_VECTOR_HPP
+#define FT_PACKED_VECTOR_HPP
+
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include "exception.hpp"
+#include "vector.hpp"
+#include "utils/swap.hpp"
+#include "utils/enable_if.hpp"
+#include "utils/simd.hpp"
+
+namespace ft {
+
+namespace _packed {
+
+typedef unsigned long long word;
+
+static const std::size_t block_size = 128;
+static const unsigned    word_bits = 64;
+
+inline unsigned bit_width(word x) {
+#if defined(__GNUC__)
+  return x ? word_bits - __builtin_clzll(x) : 0;
+#else
+  unsigned n = 0;
+  for (; x; x >>= 1)
+    ++n;
+  return n;
+#endif
+}
+
+inline word low_mask(unsigned width) {
+  return width >= word_bits ? ~word(0) : (word(1) << width) - 1;
+}
+
+// Packs n values of width bits into 2 * width words (n <= 128).
+inline void pack(const word* raw, std::size_t n, unsigned width, word* out) {
+  for (std::size_t w = 0; w < 2 * width; ++w)
+    out[w] = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::size_t bit = i * width;
+    std::size_t w = bit / word_bits;
+    unsigned shift = bit % word_bits;
+    out[w] |= raw[i] << shift;
+    if (shift && shift + width > word_bits)
+      out[w + 1] |= raw[i] >> (word_bits - shift);
+  }
+}
+
+// Values up to 56 bits wide fit in the 8 bytes starting at their first
+// byte, so each is one unaligned load, a shift and a mask. The packed
+// words end with a spare word, so the last load stays in bounds.
+inline void unpack_scalar(const word* in, unsigned width, word* raw) {
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+  word mask = low_mask(width);
+  if (width <= 56) {
+    for (std::size_t i = 0; i < block_size; ++i) {
+      std::size_t bit = i * width;
+      word chunk;
+      std::memcpy(&chunk, bytes + bit / 8, sizeof(chunk));
+      raw[i] = (chunk >> (bit % 8)) & mask;
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < block_size; ++i) {
+    std::size_t bit = i * width;
+    std::size_t w = bit / word_bits;
+    unsigned shift = bit % word_bits;
+    word v = in[w] >> shift;
+    if (shift && shift + width > word_bits)
+      v |= in[w + 1] << (word_bits - shift);
+    raw[i] = v & mask;
+  }
+}
+
+#if FT_SIMD_X86
+
+// The same loads four values at a time: a gather from byte offsets, then
+// per-lane variable shifts.
+FT_TARGET_AVX2 inline void unpack_avx2(const word* in, unsigned width, word* raw) {
+  const long long* base = reinterpret_cast<const long long*>(in);
+  const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(low_mask(width)));
+  const __m256i seven = _mm256_set1_epi64x(7);
+  const __m256i step = _mm256_set1_epi64x(4 * static_cast<long long>(width));
+  __m256i bit = _mm256_setr_epi64x(0, width, 2 * width, 3 * width);
+  for (std::size_t i = 0; i < block_size; i += 4) {
+    __m256i chunk = _mm256_i64gather_epi64(base, _mm256_srli_epi64(bit, 3), 1);
+    __m256i v = _mm256_srlv_epi64(chunk, _mm256_and_si256(bit, seven));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(raw + i), _mm256_and_si256(v, mask));
+    bit = _mm256_add_epi64(bit, step);
+  }
+}
+
+#endif
+
+inline void unpack(const word* in, unsigned width, word* raw) {
+#if FT_SIMD_X86
+  if (width <= 56 && simd_level() >= SIMD_AVX2)
+    return unpack_avx2(in, width, raw);
+#endif
+  unpack_scalar(in, width, raw);
+}
+
+template <typename T>
+word to_word(T v) { return static_cast<word>(v); }
+
+template <typename T>
+T from_word(word w) { return static_cast<T>(w); }
+
+} // namespace _packed
+
+// Width chosen per block from its largest value; base is unused.
+struct fixed_width {
+  template <typename T>
+  static _packed::word encode(T v, _packed::word) {
+    _packed::word w = _packed::to_word(v);
+    if (!std::numeric_limits<T>::is_signed)
+      return w;
+    // Sign-extended, so the top bit is the sign
+    return (w << 1) ^ (_packed::word(0) - (w >> (_packed::word_bits - 1)));
+  }
+
+  template <typename T>
+  static T decode(_packed::word bits, _packed::word) {
+    if (!std::numeric_limits<T>::is_signed)
+      return _packed::from_word<T>(bits);
+    return _packed::from_word<T>((bits >> 1) ^ (_packed::word(0) - (bits & 1)));
+  }
+
+  template <typename T>
+  static _packed::word base(const T*, std::size_t) { return 0; }
+};
+
+// Values stored as their distance from the block's minimum.
+struct frame_of_reference {
+  template <typename T>
+  static _packed::word encode(T v, _packed::word base) { return _packed::to_word(v) - base; }
+
+  template <typename T>
+  static T decode(_packed::word bits, _packed::word base) { return _packed::from_word<T>(base + bits); }
+
+  template <typename T>
+  static _packed::word base(const T* v, std::size_t n) {
+    T lo = v[0];
+    for (std::size_t i = 1; i < n; ++i)
+      lo = v[i] < lo ? v[i] : lo;
+    return _packed::to_word(lo);
+  }
+};
+
+template <typename T, typename Encoding = ft::frame_of_reference,
+          typename Alloc = std::allocator<T> >
+class packed_vector {
+public:
+  typedef T           value_type;
+  typedef Encoding    encoding_type;
+  typedef Alloc       allocator_type;
+  typedef std::size_t size_type;
+  typedef T           const_reference;
+
+  static const size_type block_size = _packed::block_size;
+
+private:
+  typedef _packed::word word;
+
+  struct block {
+    size_type offset;  // first word in _words
+    word      base;
+    unsigned  width;
+  };
+
+  typedef typename Alloc::template rebind<word>::other  word_allocator;
+  typedef typename Alloc::template rebind<block>::other block_allocator;
+
+  ft::vector<word, word_allocator>   _words;   // packed blocks, then one spare word
+  ft::vector<block, block_allocator> _blocks;
+  T                                  _tail[block_size];
+  size_type                          _size;
+
+  // Packs the full tail into a new block.
+  void flush() {
+    word raw[block_size];
+    word base = Encoding::base(_tail, block_size);
+    word widest = 0;
+    for (size_type i = 0; i < block_size; ++i) {
+      raw[i] = Encoding::encode(_tail[i], base);
+      widest |= raw[i];
+    }
+    block b;
+    b.offset = _words.empty() ? 0 : _words.size() - 1;
+    b.base = base;
+    b.width = _packed::bit_width(widest);
+    _blocks.push_back(b);
+    try {
+      // insert at end() grows geometrically; resize() would reserve exactly.
+      _words.insert(_words.end(), b.offset + 2 * b.width + 1 - _words.size(), word(0));
+    } catch (...) {
+      _blocks.pop_back();
+      throw;
+    }
+    if (b.width)
+      _packed::pack(raw, block_size, b.width, &_words[b.offset]);
+  }
+
+public:
+  // Decodes a whole block into its buffer when it enters the block and
+  // returns values by copy. Copies take only the position, not the buffer,
+  // so they and operator++(int) stay cheap; a copy refills its own buffer
+  // on its first dereference.
+  class const_iterator {
+  public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef T                       value_type;
+    typedef std::ptrdiff_t          difference_type;
+    typedef const T*                pointer;
+    typedef T                       reference;
+
+    const_iterator() : _owner(NULL), _index(0), _loaded(npos) {}
+
+    const_iterator(const const_iterator& x)
+      : _owner(x._owner), _index(x._index), _loaded(npos) {}
+
+    const_iterator& operator=(const const_iterator& x) {
+      _owner = x._owner;
+      _index = x._index;
+      _loaded = npos;
+      return *this;
+    }
+
+    T operator*() const {
+      size_type b = _index / block_size;
+      if (b != _loaded) {
+        _owner->decode_block(b, _buffer);
+        _loaded = b;
+      }
+      return _buffer[_index % block_size];
+    }
+
+    const_iterator& operator++() {
+      ++_index;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      ++_index;
+      return tmp;
+    }
+
+    size_type index() const { return _index; }
+
+    friend bool operator==(const const_iterator& x, const const_iterator& y) { return x._index == y._index; }
+    friend bool operator!=(const const_iterator& x, const const_iterator& y) { return x._index != y._index; }
+
+  private:
+    friend class packed_vector;
+
+    static const size_type npos = static_cast<size_type>(-1);
+
+    const packed_vector* _owner;
+    size_type            _index;
+    mutable size_type    _loaded;
+    mutable T            _buffer[block_size];
+
+    const_iterator(const packed_vector* owner, size_type index)
+      : _owner(owner), _index(index), _loaded(npos) {}
+  };
+
+  typedef const_iterator iterator;
+
+  explicit packed_vector(const allocator_type& alloc = allocator_type())
+    : _words(word_allocator(alloc)), _blocks(block_allocator(alloc)), _size(0) {}
+
+  template <typename InputIterator>
+  packed_vector(InputIterator first, InputIterator last,
+                const allocator_type& alloc = allocator_type(),
+                typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
+    : _words(word_allocator(alloc)), _blocks(block_allocator(alloc)), _size(0) {
+    for (; first != last; ++first)
+      push_back(*first);
+  }
+
+  size_type size() const { return _size; }
+  bool empty() const { return _size == 0; }
+  size_type max_size() const { return std::numeric_limits<size_type>::max() / 2; }
+  allocator_type get_allocator() const { return allocator_type(_words.get_allocator()); }
+
+  // Heap bytes held for the packed blocks and their index.
+  size_type bytes_used() const {
+    return _words.size() * sizeof(word) + _blocks.size() * sizeof(block);
+  }
+
+  // Reserves the block index for n values and, once blocks have been
+  // packed, words at their average width; before that the widths are
+  // unknown and only the index is reserved.
+  void reserve(size_type n) {
+    size_type blocks = n / block_size;
+    _blocks.reserve(blocks);
+    if (!_blocks.empty()) {
+      size_type per_block = (_words.size() - 1 + _blocks.size() - 1) / _blocks.size();
+      _words.reserve(blocks * per_block + 1);
+    }
+  }
+
+  void clear() {
+    _words.clear();
+    _blocks.clear();
+    _size = 0;
+  }
+
+  void push_back(const T& value) {
+    _tail[_size % block_size] = value;
+    if (++_size % block_size == 0) {
+      try {
+        flush();
+      } catch (...) {
+        --_size;
+        throw;
+      }
+    }
+  }
+
+  T operator[](size_type i) const {
+    size_type b = i / block_size;
+    if (b == _blocks.size())
+      return _tail[i % block_size];
+    const block& blk = _blocks[b];
+    std::size_t bit = (i % block_size) * blk.width;
+    const word* in = &_words[blk.offset + bit / _packed::word_bits];
+    unsigned shift = bit % _packed::word_bits;
+    word v = in[0] >> shift;
+    if (shift && shift + blk.width > _packed::word_bits)
+      v |= in[1] << (_packed::word_bits - shift);
+    return Encoding::template decode<T>(v & _packed::low_mask(blk.width), blk.base);
+  }
+
+  T at(size_type i) const {
+    if (i >= _size)
+      throw ft::out_of_range("packed_vector::at");
+    return (*this)[i];
+  }
+
+  T front() const { return (*this)[0]; }
+  T back() const { return (*this)[_size - 1]; }
+
+  // Bits per value of block b, which is the last block only once full.
+  unsigned block_width(size_type b) const { return _blocks[b].width; }
+
+  // Writes the block_size values of block b, or the tail, to out.
+  void decode_block(size_type b, T* out) const {
+    if (b == _blocks.size()) {
+      for (size_type i = 0; i < _size % block_size; ++i)
+        out[i] = _tail[i];
+      return;
+    }
+    const block& blk = _blocks[b];
+    word raw[block_size];
+    if (blk.width)
+      _packed::unpack(&_words[blk.offset], blk.width, raw);
+    else
+      for (size_type i = 0; i < block_size; ++i)
+        raw[i] = 0;
+    for (size_type i = 0; i < block_size; ++i)
+      out[i] = Encoding::template decode<T>(raw[i], blk.base);
+  }
+
+  // Decodes every value into out, which must hold size() values.
+  T* copy_to(T* out) const {
+    for (size_type b = 0; b < _blocks.size(); ++b, out += block_size)
+      decode_block(b, out);
+    decode_block(_blocks.size(), out);
+    return out + _size % block_size;
+  }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, _size); }
+
+  void swap(packed_vector& other) {
+    _words.swap(other._words);
+    _blocks.swap(other._blocks);
+    for (size_type i = 0; i < block_size; ++i)
+      ft::swap(_tail[i], other._tail[i]);
+    ft::swap(_size, other._size);
+  }
+};
+
+template <typename T, typename Encoding, typename Alloc>
+const typename packed_vector<T, Encoding, Alloc>::size_type packed_vector<T, Encoding, Alloc>::block_size;
+
+template <typename T, typename Encoding, typename Alloc>
+void swap(packed_vector<T, Encoding, Alloc>& x, packed_vector<T, Encoding, Alloc>& y) {
+  x.swap(y);
+}
+
+} // namespace ft
+
+#endif // FT_PACKED_VECTOR_HPP
@@ -0,0 +1,276 @@
+// Fixed-capacity double-ended queue over a single power-of-two allocation.
+// Unlike ft::deque there is no block map: element i lives at
+// _data[(_head + i) & _mask].
+
+#ifndef FT_RING_BUFFER_HPP
+#define FT_RING_BUFFER_HPP
+
+#include <memory>
+#include <cstddef>
+#include <algorithm>
+#include "exception.hpp"
+#include "utils/swap.hpp"
+#include "iterators/ring_buffer_iterator.hpp"
+#include "iterators/reverse_iterator.hpp"
+
+namespace ft {
+
+template <typename T, typename Alloc = std::allocator<T> >
+class ring_buffer {
+public:
+  typedef T                                       value_type;
+  typedef Alloc                                   allocator_type;
+  typedef typename allocator_type::reference      reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer        pointer;
+  typedef typename allocator_type::const_pointer  const_pointer;
+  typedef std::size_t                             size_type;
+  typedef std::ptrdiff_t                          difference_type;
+
+  typedef ft::ring_buffer_iterator<T>             iterator;
+  typedef ft::ring_buffer_iterator<const T>       const_iterator;
+  typedef ft::reverse_iterator<iterator>          reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+private:
+  allocator_type _alloc;
+  pointer        _data;
+  size_type      _mask;
+  size_type      _head;      // logical index of the front element
+  size_type      _tail;      // logical index one past the back element
+  bool           _overwrite; // drop the oldest element instead of throwing when full
+
+  static size_type round_up_pow2(size_type n) {
+    size_type cap = 1;
+    while (cap < n)
+      cap <<= 1;
+    return cap;
+  }
+
+  pointer slot(size_type logical) const { return _data + (logical & _mask); }
+
+  // Constructs count elements from src starting at logical index pos, as at
+  // most two contiguous runs: up to the physical end, then from the start.
+  // If a copy throws, the elements already built are destroyed again.
+  void construct_segments(size_type pos, const_pointer src, size_type count) {
+    size_type offset = pos & _mask;
+    size_type first = std::min(count, capacity() - offset);
+    size_type i = 0;
+    try {
+      for (; i < first; ++i)
+        _alloc.construct(_data + offset + i, src[i]);
+      for (; i < count; ++i)
+        _alloc.construct(_data + (i - first), src[i]);
+    } catch (...) {
+      while (i)
+        _alloc.destroy(slot(pos + --i));
+      throw;
+    }
+  }
+
+  // Moves count elements out of the front, again as at most two runs.
+  void extract_segments(pointer dst, size_type count) {
+    size_type offset = _head & _mask;
+    size_type first = std::min(count, capacity() - offset);
+    for (size_type i = 0; i < first; ++i) {
+      if (dst)
+        dst[i] = _data[offset + i];
+      _alloc.destroy(_data + offset + i);
+    }
+    for (size_type i = first; i < count; ++i) {
+      if (dst)
+        dst[i] = _data[i - first];
+      _alloc.destroy(_data + (i - first));
+    }
+    _head += count;
+  }
+
+  void make_room(const char* what) {
+    if (!_overwrite || capacity() == 0)
+      throw ft::length_error(what);
+  }
+
+public:
+  explicit ring_buffer(size_type capacity = 0, bool overwrite = false,
+                       const allocator_type& alloc = allocator_type())
+    : _alloc(alloc), _data(NULL), _mask(0), _head(0), _tail(0), _overwrite(overwrite) {
+    if (capacity > max_size())
+      throw ft::length_error("ring_buffer: capacity exceeds max_size");
+    if (capacity) {
+      size_type cap = round_up_pow2(capacity);
+      _data = _alloc.allocate(cap);
+      _mask = cap - 1;
+    }
+  }
+
+  ring_buffer(const ring_buffer& x)
+    : _alloc(x._alloc), _data(NULL), _mask(x._mask), _head(0), _tail(0), _overwrite(x._overwrite) {
+    if (x._data) {
+      _data = _alloc.allocate(x.capacity());
+      try {
+        for (const_iterator it = x.begin(); it != x.end(); ++it, ++_tail)
+          _alloc.construct(slot(_tail), *it);
+      } catch (...) {
+        clear();
+        _alloc.deallocate(_data, capacity());
+        throw;
+      }
+    }
+  }
+
+  ~ring_buffer() {
+    clear();
+    if (_data)
+      _alloc.deallocate(_data, capacity());
+  }
+
+  ring_buffer& operator=(const ring_buffer& x) {
+    if (this != &x) {
+      ring_buffer tmp(x);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  // Iterators
+  iterator begin() { return iterator(_data, _mask, _head); }
+  const_iterator begin() const { return const_iterator(_data, _mask, _head); }
+  iterator end() { return iterator(_data, _mask, _tail); }
+  const_iterator end() const { return const_iterator(_data, _mask, _tail); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  // Capacity
+  size_type size() const { return _tail - _head; }
+  size_type capacity() const { return _data ? _mask + 1 : 0; }
+  size_type max_size() const { return _alloc.max_size(); }
+  bool empty() const { return _head == _tail; }
+  bool full() const { return size() == capacity(); }
+  bool overwrites() const { return _overwrite; }
+  void set_overwrite(bool overwrite) { _overwrite = overwrite; }
+
+  // Element access
+  reference operator[](size_type n) { return *slot(_head + n); }
+  const_reference operator[](size_type n) const { return *slot(_head + n); }
+
+  reference at(size_type n) {
+    if (n >= size())
+      throw ft::out_of_range("ring_buffer::at");
+    return *slot(_head + n);
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= size())
+      throw ft::out_of_range("ring_buffer::at");
+    return *slot(_head + n);
+  }
+
+  reference front() { return *slot(_head); }
+  const_reference front() const { return *slot(_head); }
+  reference back() { return *slot(_tail - 1); }
+  const_reference back() const { return *slot(_tail - 1); }
+
+  // Modifiers
+  void push_back(const value_type& val) {
+    if (full()) {
+      make_room("ring_buffer::push_back: buffer full");
+      pop_front();
+    }
+    _alloc.construct(slot(_tail), val);
+    ++_tail;
+  }
+
+  void push_front(const value_type& val) {
+    if (full()) {
+      make_room("ring_buffer::push_front: buffer full");
+      pop_back();
+    }
+    _alloc.construct(slot(_head - 1), val);
+    --_head;
+  }
+
+  void pop_front() {
+    if (!empty()) {
+      _alloc.destroy(slot(_head));
+      ++_head;
+    }
+  }
+
+  void pop_back() {
+    if (!empty()) {
+      --_tail;
+      _alloc.destroy(slot(_tail));
+    }
+  }
+
+  // Appends the n elements at src. Without overwrite, only as many as fit are
+  // taken; with overwrite, the oldest elements are dropped to make room and
+  // only the newest capacity() values of src are kept. Returns the number of
+  // elements of src consumed.
+  size_type push_back_n(const_pointer src, size_type n) {
+    size_type cap = capacity();
+    if (!_overwrite) {
+      n = std::min(n, cap - size());
+    } else if (n >= cap) {
+      clear();
+      _head = _tail = 0;
+      construct_segments(_tail, src + (n - cap), cap);
+      _tail += cap;
+      return n;
+    } else if (n > cap - size()) {
+      extract_segments(NULL, n - (cap - size()));
+    }
+    construct_segments(_tail, src, n);
+    _tail += n;
+    return n;
+  }
+
+  // Removes up to n elements from the front, assigning them to dst in order
+  // when dst is not NULL. Returns the number of elements removed.
+  size_type pop_front_n(pointer dst, size_type n) {
+    n = std::min(n, size());
+    extract_segments(dst, n);
+    return n;
+  }
+
+  void clear() {
+    extract_segments(NULL, size());
+  }
+
+  void swap(ring_buffer& other) {
+    ft::swap(_alloc, other._alloc);
+    ft::swap(_data, other._data);
+    ft::swap(_mask, other._mask);
+    ft::swap(_head, other._head);
+    ft::swap(_tail, other._tail);
+    ft::swap(_overwrite, other._overwrite);
+  }
+
+  allocator_type get_allocator() const { return _alloc; }
+};
+
+// Non-member swap
+template <typename T, typename Alloc>
+void swap(ring_buffer<T, Alloc>& x, ring_buffer<T, Alloc>& y) {
+  x.swap(y);
+}
+
+// Relational operators
+template <typename T, typename Alloc>
+bool operator==(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  for (std::size_t i = 0; i < lhs.size(); ++i)
+    if (!(lhs[i] == rhs[i])) return false;
+  return true;
+}
+
+template <typename T, typename Alloc>
+bool operator!=(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+} // namespace ft
+
+#endif // FT_RING_BUFFER_HPP
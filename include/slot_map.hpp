@@ -0,0 +1,209 @@
+// Slot map, after the P0661 proposal: insert returns a key, and lookup,
+// erase and insert through keys are O(1). Values sit packed in one
+// ft::vector, so iteration runs at vector speed. Each key names a slot
+// holding the value's position and a generation count. Erase moves the
+// last value into the hole (swap-and-pop) and bumps the slot's
+// generation, so a key to an erased value no longer matches and is
+// detected as stale, even after its slot has been reused.
+
+#ifndef FT_SLOT_MAP_HPP
+#define FT_SLOT_MAP_HPP
+
+#include <memory>
+#include <cstddef>
+#include "exception.hpp"
+#include "vector.hpp"
+#include "utils/swap.hpp"
+
+namespace ft {
+
+struct slot_map_key {
+  unsigned int index;
+  unsigned int generation;
+};
+
+inline bool operator==(const slot_map_key& x, const slot_map_key& y) {
+  return x.index == y.index && x.generation == y.generation;
+}
+
+inline bool operator!=(const slot_map_key& x, const slot_map_key& y) {
+  return !(x == y);
+}
+
+// Iteration order is the dense order, which erase changes: the last value
+// takes the erased one's place. A slot's generation is odd while it holds
+// a value and even while free, so no key ever matches a free slot; it
+// wraps after 2^31 reuses of the same slot, when a very old key could
+// match again.
+template <typename T, typename Alloc = std::allocator<T> >
+class slot_map {
+public:
+  typedef T                                       value_type;
+  typedef slot_map_key                            key_type;
+  typedef Alloc                                   allocator_type;
+  typedef typename allocator_type::reference      reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef std::size_t                             size_type;
+
+  typedef ft::vector<T, Alloc>                    container_type;
+  typedef typename container_type::iterator       iterator;
+  typedef typename container_type::const_iterator const_iterator;
+
+private:
+  static const unsigned int none = static_cast<unsigned int>(-1);
+
+  // Position in _values while occupied, next free slot while not
+  struct slot {
+    unsigned int index;
+    unsigned int generation;
+  };
+
+  typedef typename Alloc::template rebind<slot>::other         slot_allocator_type;
+  typedef typename Alloc::template rebind<unsigned int>::other index_allocator_type;
+
+  container_type                               _values;
+  ft::vector<unsigned int, index_allocator_type> _owners;  // value position -> slot
+  ft::vector<slot, slot_allocator_type>        _slots;
+  unsigned int                                 _free_head;
+
+  void check_key(const key_type& k, const char* what) const {
+    if (!contains(k))
+      throw ft::out_of_range(what);
+  }
+
+public:
+  explicit slot_map(const allocator_type& alloc = allocator_type())
+    : _values(alloc), _owners(index_allocator_type(alloc)), _slots(slot_allocator_type(alloc)),
+      _free_head(none) {}
+
+  // Capacity
+  bool empty() const { return _values.empty(); }
+  size_type size() const { return _values.size(); }
+  size_type capacity() const { return _values.capacity(); }
+
+  void reserve(size_type n) {
+    _values.reserve(n);
+    _owners.reserve(n);
+    _slots.reserve(n);
+  }
+
+  // Iterators over the packed values
+  iterator begin() { return _values.begin(); }
+  const_iterator begin() const { return _values.begin(); }
+  iterator end() { return _values.end(); }
+  const_iterator end() const { return _values.end(); }
+
+  // Lookup. Only odd generations name a value, so forged keys, including
+  // a zero key, never match a free slot.
+  bool contains(const key_type& k) const {
+    return (k.generation & 1) && k.index < _slots.size() &&
+           _slots[k.index].generation == k.generation;
+  }
+
+  reference operator[](const key_type& k) { return _values[_slots[k.index].index]; }
+  const_reference operator[](const key_type& k) const { return _values[_slots[k.index].index]; }
+
+  reference at(const key_type& k) {
+    check_key(k, "slot_map::at");
+    return (*this)[k];
+  }
+
+  const_reference at(const key_type& k) const {
+    check_key(k, "slot_map::at");
+    return (*this)[k];
+  }
+
+  // The value of k, or end() if k is stale
+  iterator find(const key_type& k) {
+    return contains(k) ? _values.begin() + _slots[k.index].index : _values.end();
+  }
+
+  const_iterator find(const key_type& k) const {
+    return contains(k) ? _values.begin() + _slots[k.index].index : _values.end();
+  }
+
+  // Key of the value at pos, for walks over begin() / end()
+  key_type key_of(const_iterator pos) const {
+    key_type k;
+    k.index = _owners[pos - _values.begin()];
+    k.generation = _slots[k.index].generation;
+    return k;
+  }
+
+  // Modifiers
+  key_type insert(const value_type& val) {
+    if (_free_head == none) {
+      slot s;
+      s.index = none;
+      s.generation = 0;
+      _slots.push_back(s);
+      _free_head = static_cast<unsigned int>(_slots.size() - 1);
+    }
+    _owners.push_back(_free_head);
+    try {
+      _values.push_back(val);
+    } catch (...) {
+      _owners.pop_back();
+      throw;
+    }
+    key_type k;
+    k.index = _free_head;
+    slot& s = _slots[k.index];
+    _free_head = s.index;
+    s.index = static_cast<unsigned int>(_values.size() - 1);
+    k.generation = ++s.generation;
+    return k;
+  }
+
+  // Moves the last value into k's place, then frees k's slot
+  void erase(const key_type& k) {
+    check_key(k, "slot_map::erase");
+    slot& s = _slots[k.index];
+    unsigned int position = s.index;
+    unsigned int last = static_cast<unsigned int>(_values.size() - 1);
+    if (position != last) {
+      _values[position] = _values[last];
+      _owners[position] = _owners[last];
+      _slots[_owners[position]].index = position;
+    }
+    _values.pop_back();
+    _owners.pop_back();
+    ++s.generation;
+    s.index = _free_head;
+    _free_head = k.index;
+  }
+
+  // Stale keys stay stale: slots are kept and their generations bumped
+  void clear() {
+    while (!_values.empty()) {
+      unsigned int i = _owners.back();
+      ++_slots[i].generation;
+      _slots[i].index = _free_head;
+      _free_head = i;
+      _values.pop_back();
+      _owners.pop_back();
+    }
+  }
+
+  void swap(slot_map& other) {
+    _values.swap(other._values);
+    _owners.swap(other._owners);
+    _slots.swap(other._slots);
+    ft::swap(_free_head, other._free_head);
+  }
+
+  allocator_type get_allocator() const { return _values.get_allocator(); }
+};
+
+template <typename T, typename Alloc>
+const unsigned int slot_map<T, Alloc>::none;
+
+// Non-member swap
+template <typename T, typename Alloc>
+void swap(slot_map<T, Alloc>& x, slot_map<T, Alloc>& y) {
+  x.swap(y);
+}
+
+} // namespace ft
+
+#endif // FT_SLOT_MAP_HPP
@@ -0,0 +1,540 @@
+// Vector with inline storage for N elements. It allocates only once it
+// grows past N and from then on behaves like ft::vector. Iterators and
+// references are invalidated by anything that relocates the elements,
+// which for an inline vector includes swap.
+
+#ifndef FT_SMALL_VECTOR_HPP
+#define FT_SMALL_VECTOR_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+#include "exception.hpp"
+#include "utils/swap.hpp"
+#include "utils/enable_if.hpp"
+#include "utils/simd.hpp"
+#include "utils/uninitialized.hpp"
+#include "iterators/random_access_iterator.hpp"
+#include "iterators/reverse_iterator.hpp"
+
+namespace ft {
+
+template <typename T, std::size_t N, typename Alloc = std::allocator<T> >
+class small_vector {
+public:
+  typedef T                                       value_type;
+  typedef Alloc                                   allocator_type;
+  typedef typename allocator_type::reference      reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer        pointer;
+  typedef typename allocator_type::const_pointer  const_pointer;
+  typedef std::size_t                             size_type;
+  typedef std::ptrdiff_t                          difference_type;
+
+  typedef ft::random_access_iterator<T>           iterator;
+  typedef ft::random_access_iterator<const T>     const_iterator;
+  typedef ft::reverse_iterator<iterator>          reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+  static const size_type inline_capacity = N;
+
+private:
+  // Raw inline slots, aligned for T. Before C++11 only the alignment of
+  // the scalar types is available, which over-aligned T may exceed.
+#if __cplusplus >= 201103L
+  struct inline_storage {
+    alignas(T) char bytes[(N ? N : 1) * sizeof(T)];
+  };
+#else
+  union inline_storage {
+    char        bytes[(N ? N : 1) * sizeof(T)];
+    long double align_float;
+    long long   align_int;
+    void*       align_pointer;
+  };
+#endif
+
+  // n copies of one value, indexed like the array insert_from reads
+  struct repeat {
+    const value_type& value;
+    explicit repeat(const value_type& v) : value(v) {}
+    const value_type& operator[](size_type) const { return value; }
+  };
+
+  allocator_type _alloc;
+  pointer        _data;      // inline slots or a heap block
+  size_type      _size;
+  size_type      _capacity;
+  inline_storage _storage;
+
+  pointer inline_data() { return reinterpret_cast<pointer>(_storage.bytes); }
+
+  void reset_to_inline() {
+    _data = inline_data();
+    _size = 0;
+    _capacity = N;
+  }
+
+  void destroy_elements() {
+    for (size_type i = 0; i < _size; ++i)
+      _alloc.destroy(_data + i);
+  }
+
+  void release() {
+    if (!is_inline())
+      _alloc.deallocate(_data, _capacity);
+  }
+
+  // Relocates the elements to a heap block of new_capacity slots. The old
+  // elements are only destroyed once all of them have been moved.
+  void reallocate(size_type new_capacity) {
+    pointer new_data = _alloc.allocate(new_capacity);
+    try {
+      ft::uninitialized_move(_data, _data + _size, new_data, _alloc);
+    } catch (...) {
+      _alloc.deallocate(new_data, new_capacity);
+      throw;
+    }
+    destroy_elements();
+    release();
+    _data = new_data;
+    _capacity = new_capacity;
+  }
+
+  void ensure_capacity(size_type min_capacity) {
+    if (min_capacity > _capacity)
+      reserve(std::max(_capacity * 2, min_capacity));
+  }
+
+  // Inserts src[0], ..., src[n - 1] at index; src must not alias the
+  // vector. Growth fills a new block completely before the old one is
+  // released, so a throwing copy leaves the vector unchanged. In place, the
+  // slots past the old end are constructed before anything is assigned, so
+  // a throw leaves every slot below size() constructed.
+  template <typename Source>
+  void insert_from(size_type index, const Source& src, size_type n) {
+    if (_size + n > _capacity) {
+      size_type new_capacity = std::max(_capacity * 2, _size + n);
+      if (new_capacity > max_size())
+        throw ft::length_error("small_vector::insert: size exceeds max_size");
+      pointer new_data = _alloc.allocate(new_capacity);
+      pointer built = new_data;
+      try {
+        built = ft::uninitialized_copy(_data, _data + index, new_data, _alloc);
+        for (size_type i = 0; i < n; ++i, ++built)
+          _alloc.construct(built, src[i]);
+        ft::uninitialized_copy(_data + index, _data + _size, built, _alloc);
+      } catch (...) {
+        ft::destroy(new_data, built, _alloc);
+        _alloc.deallocate(new_data, new_capacity);
+        throw;
+      }
+      destroy_elements();
+      release();
+      _data = new_data;
+      _capacity = new_capacity;
+      _size += n;
+      return;
+    }
+    size_type after = _size - index;
+    pointer old_end = _data + _size;
+    if (after > n) {
+      ft::uninitialized_copy(old_end - n, old_end, old_end, _alloc);
+      _size += n;
+      std::copy_backward(_data + index, old_end - n, old_end);
+      for (size_type i = 0; i < n; ++i)
+        _data[index + i] = src[i];
+    } else {
+      pointer built = old_end;
+      try {
+        for (size_type i = after; i < n; ++i, ++built)
+          _alloc.construct(built, src[i]);
+        ft::uninitialized_copy(_data + index, old_end, built, _alloc);
+      } catch (...) {
+        ft::destroy(old_end, built, _alloc);
+        throw;
+      }
+      _size += n;
+      for (size_type i = 0; i < after; ++i)
+        _data[index + i] = src[i];
+    }
+  }
+
+  // Destroys the tail left behind by an in-place compaction.
+  size_type truncate(pointer new_end) {
+    size_type removed = (_data + _size) - new_end;
+    for (pointer p = new_end; p != _data + _size; ++p)
+      _alloc.destroy(p);
+    _size -= removed;
+    return removed;
+  }
+
+  // Both inline: relocate the longer tail, then swap the common prefix.
+  // A throw while relocating changes nothing; one from swapping the prefix
+  // leaves both vectors valid with the prefix partly swapped.
+  void swap_inline(small_vector& other) {
+    small_vector& longer = _size >= other._size ? *this : other;
+    small_vector& shorter = _size >= other._size ? other : *this;
+    pointer tail = longer._data + shorter._size;
+    pointer tail_end = longer._data + longer._size;
+    pointer dest = shorter._data + shorter._size;
+    ft::uninitialized_move(tail, tail_end, dest, _alloc);
+    try {
+      for (size_type i = 0; i < shorter._size; ++i)
+        ft::swap(_data[i], other._data[i]);
+    } catch (...) {
+      ft::destroy(dest, dest + (tail_end - tail), _alloc);
+      throw;
+    }
+    ft::destroy(tail, tail_end, _alloc);
+    ft::swap(_size, other._size);
+  }
+
+  // This one on the heap, small inline: small's elements move into our
+  // inline slots and small takes over the heap block. A throwing move
+  // leaves both unchanged.
+  void swap_heap_with_inline(small_vector& small) {
+    ft::uninitialized_move(small._data, small._data + small._size, inline_data(), _alloc);
+    small.destroy_elements();
+    small._data = _data;
+    small._capacity = _capacity;
+    _data = inline_data();
+    _capacity = N;
+    ft::swap(_size, small._size);
+  }
+
+#if __cplusplus >= 201103L
+  // Takes x's heap block, or moves its inline elements one by one.
+  void steal(small_vector& x) {
+    if (!x.is_inline()) {
+      _data = x._data;
+      _size = x._size;
+      _capacity = x._capacity;
+    } else {
+      for (; _size < x._size; ++_size)
+        _alloc.construct(_data + _size, std::move(x._data[_size]));
+      x.destroy_elements();
+    }
+    x.reset_to_inline();
+  }
+#endif
+
+public:
+  explicit small_vector(const allocator_type& alloc = allocator_type())
+    : _alloc(alloc) {
+    reset_to_inline();
+  }
+
+  small_vector(size_type n, const value_type& val = value_type(),
+               const allocator_type& alloc = allocator_type())
+    : _alloc(alloc) {
+    reset_to_inline();
+    try {
+      reserve(n);
+      for (; _size < n; ++_size)
+        _alloc.construct(_data + _size, val);
+    } catch (...) {
+      destroy_elements();
+      release();
+      throw;
+    }
+  }
+
+  template <typename InputIterator>
+  small_vector(InputIterator first, InputIterator last,
+               const allocator_type& alloc = allocator_type(),
+               typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
+    : _alloc(alloc) {
+    reset_to_inline();
+    try {
+      for (; first != last; ++first)
+        push_back(*first);
+    } catch (...) {
+      destroy_elements();
+      release();
+      throw;
+    }
+  }
+
+  small_vector(const small_vector& x)
+    : _alloc(x._alloc) {
+    reset_to_inline();
+    try {
+      reserve(x._size);
+      for (; _size < x._size; ++_size)
+        _alloc.construct(_data + _size, x._data[_size]);
+    } catch (...) {
+      destroy_elements();
+      release();
+      throw;
+    }
+  }
+
+#if __cplusplus >= 201103L
+  small_vector(small_vector&& x)
+    : _alloc(x._alloc) {
+    reset_to_inline();
+    steal(x);
+  }
+
+  small_vector& operator=(small_vector&& x) {
+    if (this != &x) {
+      clear();
+      release();
+      reset_to_inline();
+      _alloc = x._alloc;
+      steal(x);
+    }
+    return *this;
+  }
+#endif
+
+  ~small_vector() {
+    destroy_elements();
+    release();
+  }
+
+  small_vector& operator=(const small_vector& x) {
+    if (this != &x) {
+      small_vector tmp(x);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  // Iterators
+  iterator begin() { return iterator(_data); }
+  const_iterator begin() const { return const_iterator(_data); }
+  iterator end() { return iterator(_data + _size); }
+  const_iterator end() const { return const_iterator(_data + _size); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  // Capacity
+  size_type size() const { return _size; }
+  size_type max_size() const { return _alloc.max_size(); }
+  size_type capacity() const { return _capacity; }
+  bool empty() const { return _size == 0; }
+  bool is_inline() const { return _data == reinterpret_cast<const_pointer>(_storage.bytes); }
+
+  void resize(size_type n, value_type val = value_type()) {
+    if (n < _size) {
+      for (size_type i = n; i < _size; ++i)
+        _alloc.destroy(_data + i);
+    } else if (n > _size) {
+      reserve(n);
+      for (size_type i = _size; i < n; ++i)
+        _alloc.construct(_data + i, val);
+    }
+    _size = n;
+  }
+
+  void reserve(size_type n) {
+    if (n <= _capacity) return;
+    if (n > max_size())
+      throw ft::length_error("small_vector::reserve: n exceeds max_size");
+    reallocate(n);
+  }
+
+  // Moves the elements back into the inline slots when they fit, otherwise
+  // into a heap block of exactly size() slots.
+  void shrink_to_fit() {
+    if (is_inline() || _size == _capacity)
+      return;
+    if (_size > N) {
+      reallocate(_size);
+      return;
+    }
+    ft::uninitialized_move(_data, _data + _size, inline_data(), _alloc);
+    destroy_elements();
+    release();
+    _data = inline_data();
+    _capacity = N;
+  }
+
+  // Element access
+  reference operator[](size_type n) { return _data[n]; }
+  const_reference operator[](size_type n) const { return _data[n]; }
+
+  reference at(size_type n) {
+    if (n >= _size)
+      throw ft::out_of_range("small_vector::at");
+    return _data[n];
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= _size)
+      throw ft::out_of_range("small_vector::at");
+    return _data[n];
+  }
+
+  reference front() { return _data[0]; }
+  const_reference front() const { return _data[0]; }
+  reference back() { return _data[_size - 1]; }
+  const_reference back() const { return _data[_size - 1]; }
+
+  // Modifiers
+  template <class InputIterator>
+  void assign(InputIterator first, InputIterator last,
+              typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+    clear();
+    for (; first != last; ++first)
+      push_back(*first);
+  }
+
+  void assign(size_type n, const value_type& val) {
+    value_type value(val);  // val may live in this vector
+    clear();
+    reserve(n);
+    for (; _size < n; ++_size)
+      _alloc.construct(_data + _size, value);
+  }
+
+  iterator insert(iterator position, const value_type& val) {
+    size_type index = position - begin();
+    value_type value(val);
+    insert_from(index, repeat(value), 1);
+    return iterator(_data + index);
+  }
+
+  void insert(iterator position, size_type n, const value_type& val) {
+    if (n == 0) return;
+    size_type index = position - begin();
+    value_type value(val);
+    insert_from(index, repeat(value), n);
+  }
+
+  template <class InputIterator>
+  void insert(iterator position, InputIterator first, InputIterator last,
+              typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+    size_type index = position - begin();
+    small_vector temp(first, last);
+    if (temp.empty()) return;
+    insert_from(index, static_cast<const_pointer>(temp._data), temp._size);
+  }
+
+  iterator erase(iterator position) {
+    return erase(position, position + 1);
+  }
+
+  iterator erase(iterator first, iterator last) {
+    if (first == last) return first;
+    size_type start = first - begin();
+    size_type count = last - first;
+    for (size_type i = start; i + count < _size; ++i)
+      _data[i] = _data[i + count];
+    for (size_type i = _size - count; i < _size; ++i)
+      _alloc.destroy(_data + i);
+    _size -= count;
+    return iterator(_data + start);
+  }
+
+  // One-pass compaction as in ft::vector; each returns the number removed.
+  template <typename Predicate>
+  size_type erase_if(Predicate pred) {
+    return truncate(_simd::dispatch<T>::remove_if(_data, _data + _size, pred));
+  }
+
+  size_type remove(const value_type& val) {
+    value_type value(val);
+    return truncate(_simd::dispatch<T>::remove(_data, _data + _size, value));
+  }
+
+  size_type unique() {
+    return truncate(_simd::dispatch<T>::unique(_data, _data + _size));
+  }
+
+  void push_back(const value_type& val) {
+    if (_size == _capacity) {
+      value_type value(val);
+      ensure_capacity(_size + 1);
+      _alloc.construct(_data + _size, value);
+    } else {
+      _alloc.construct(_data + _size, val);
+    }
+    ++_size;
+  }
+
+  void pop_back() {
+    if (_size > 0) {
+      --_size;
+      _alloc.destroy(_data + _size);
+    }
+  }
+
+  void clear() {
+    destroy_elements();
+    _size = 0;
+  }
+
+  void swap(small_vector& other) {
+    if (this == &other)
+      return;
+    if (is_inline() && other.is_inline()) {
+      swap_inline(other);
+    } else if (is_inline()) {
+      other.swap_heap_with_inline(*this);
+    } else if (other.is_inline()) {
+      swap_heap_with_inline(other);
+    } else {
+      ft::swap(_data, other._data);
+      ft::swap(_size, other._size);
+      ft::swap(_capacity, other._capacity);
+    }
+    ft::swap(_alloc, other._alloc);
+  }
+
+  allocator_type get_allocator() const { return _alloc; }
+};
+
+template <typename T, std::size_t N, typename Alloc>
+const typename small_vector<T, N, Alloc>::size_type small_vector<T, N, Alloc>::inline_capacity;
+
+// Non-member swap
+template <typename T, std::size_t N, typename Alloc>
+void swap(small_vector<T, N, Alloc>& x, small_vector<T, N, Alloc>& y) {
+  x.swap(y);
+}
+
+// Relational operators
+template <typename T, std::size_t N, typename Alloc>
+bool operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return _simd::dispatch<T>::equal(lhs.begin().base(), rhs.begin().base(), lhs.size());
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+  return _simd::dispatch<T>::less(lhs.begin().base(), lhs.size(), rhs.begin().base(), rhs.size());
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+} // namespace ft
+
+#endif // FT_SMALL_VECTOR_HPP
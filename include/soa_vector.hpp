@@ -0,0 +1,572 @@
+// Vector of aggregates stored as a structure of arrays: each field of T
+// lives in its own contiguous column, so a pass over one field reads only
+// that field's bytes and vectorizes like a loop over a plain array. The
+// fields come from ft::soa_traits<T>, which the user specializes:
+//
+//   namespace ft {
+//   template <>
+//   struct soa_traits<Point> {
+//     typedef soa_fields<soa_field<Point, int, &Point::x>,
+//                        soa_field<Point, int, &Point::y> > fields;
+//   };
+//   }
+//
+// T must be default constructible and fully described by its fields: an
+// element is rebuilt from the columns on every read. Elements are reached
+// by index; operator[] returns a proxy that converts to T, assigns from T
+// and exposes the element's fields, and field<I>() returns column I as a
+// span. Every modifier keeps all columns the same length.
+
+#ifndef FT_SOA_VECTOR_HPP
+#define FT_SOA_VECTOR_HPP
+
+#include <memory>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include <utility>
+#include "exception.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+#include "utils/swap.hpp"
+#include "utils/growth_policy.hpp"
+#include "utils/uninitialized.hpp"
+
+namespace ft {
+
+struct soa_nil {};
+
+// One field of T: its type and the member that holds it.
+template <typename T, typename F, F T::*Member>
+struct soa_field {
+  typedef F type;
+  static F T::* member() { return Member; }
+};
+
+// The fields of T in column order, up to eight.
+template <typename F0 = soa_nil, typename F1 = soa_nil, typename F2 = soa_nil,
+          typename F3 = soa_nil, typename F4 = soa_nil, typename F5 = soa_nil,
+          typename F6 = soa_nil, typename F7 = soa_nil>
+struct soa_fields {
+  typedef F0                                             head;
+  typedef soa_fields<F1, F2, F3, F4, F5, F6, F7, soa_nil> tail;
+  static const std::size_t count = 1 + tail::count;
+};
+
+template <>
+struct soa_fields<> {
+  static const std::size_t count = 0;
+};
+
+template <typename T>
+struct soa_traits;
+
+// A column viewed as a plain array.
+template <typename T>
+class field_span {
+public:
+  typedef T           value_type;
+  typedef T*          iterator;
+  typedef std::size_t size_type;
+
+  field_span(T* data, size_type size) : _data(data), _size(size) {}
+
+  T* data() const { return _data; }
+  size_type size() const { return _size; }
+  bool empty() const { return _size == 0; }
+  T* begin() const { return _data; }
+  T* end() const { return _data + _size; }
+  T& operator[](size_type i) const { return _data[i]; }
+
+private:
+  T*        _data;
+  size_type _size;
+};
+
+namespace _soa {
+
+// One column per field, chained through rest. Each operation walks the
+// chain; an exception part way through undoes the columns already done.
+template <typename T, typename Fields, typename Alloc>
+struct columns {
+  typedef typename Fields::head                               field;
+  typedef typename field::type                                field_type;
+  typedef typename Alloc::template rebind<field_type>::other  allocator_type;
+  typedef columns<T, typename Fields::tail, Alloc>            rest_type;
+
+  allocator_type _alloc;
+  field_type*    _data;
+  rest_type      _rest;
+
+  explicit columns(const Alloc& alloc) : _alloc(alloc), _data(NULL), _rest(alloc) {}
+
+  static std::size_t row_size() { return sizeof(field_type) + rest_type::row_size(); }
+
+  void allocate(std::size_t n) {
+    _data = _alloc.allocate(n);
+    try {
+      _rest.allocate(n);
+    } catch (...) {
+      _alloc.deallocate(_data, n);
+      _data = NULL;
+      throw;
+    }
+  }
+
+  void deallocate(std::size_t n) {
+    if (_data)
+      _alloc.deallocate(_data, n);
+    _data = NULL;
+    _rest.deallocate(n);
+  }
+
+  void destroy(std::size_t first, std::size_t last) {
+    ft::destroy(_data + first, _data + last, _alloc);
+    _rest.destroy(first, last);
+  }
+
+  // Copy-constructs src's first n rows into this one's raw columns.
+  void copy_from(const columns& src, std::size_t n) {
+    ft::uninitialized_copy(src._data, src._data + n, _data, _alloc);
+    try {
+      _rest.copy_from(src._rest, n);
+    } catch (...) {
+      ft::destroy(_data, _data + n, _alloc);
+      throw;
+    }
+  }
+
+  void move_from(columns& src, std::size_t n) {
+    ft::uninitialized_move(src._data, src._data + n, _data, _alloc);
+    try {
+      _rest.move_from(src._rest, n);
+    } catch (...) {
+      ft::destroy(_data, _data + n, _alloc);
+      throw;
+    }
+  }
+
+  // Row i of this one's raw columns becomes src's row order[i].
+  void gather_from(const columns& src, const std::size_t* order, std::size_t n) {
+    std::size_t i = 0;
+    try {
+      for (; i < n; ++i)
+        _alloc.construct(_data + i, src._data[order[i]]);
+      _rest.gather_from(src._rest, order, n);
+    } catch (...) {
+      ft::destroy(_data, _data + i, _alloc);
+      throw;
+    }
+  }
+
+  void construct(std::size_t i, const T& value) {
+    _alloc.construct(_data + i, value.*field::member());
+    try {
+      _rest.construct(i, value);
+    } catch (...) {
+      _alloc.destroy(_data + i);
+      throw;
+    }
+  }
+
+  void construct_n(std::size_t first, std::size_t n, const T& value) {
+    ft::uninitialized_fill_n(_data + first, n, value.*field::member(), _alloc);
+    try {
+      _rest.construct_n(first, n, value);
+    } catch (...) {
+      ft::destroy(_data + first, _data + first + n, _alloc);
+      throw;
+    }
+  }
+
+  void assign(std::size_t i, const T& value) {
+    _data[i] = value.*field::member();
+    _rest.assign(i, value);
+  }
+
+  void load(std::size_t i, T& value) const {
+    value.*field::member() = _data[i];
+    _rest.load(i, value);
+  }
+
+  // Shifts rows [pos, size) up by one, constructing the new last row.
+  void shift_up(std::size_t pos, std::size_t size) {
+    _alloc.construct(_data + size, _data[size - 1]);
+    std::copy_backward(_data + pos, _data + size - 1, _data + size);
+    _rest.shift_up(pos, size);
+  }
+
+  // Moves rows [last, size) down onto first and destroys the tail.
+  void close_gap(std::size_t first, std::size_t last, std::size_t size) {
+    std::copy(_data + last, _data + size, _data + first);
+    ft::destroy(_data + size - (last - first), _data + size, _alloc);
+    _rest.close_gap(first, last, size);
+  }
+
+  bool equal(const columns& other, std::size_t n) const {
+    return std::equal(_data, _data + n, other._data) && _rest.equal(other._rest, n);
+  }
+
+  void swap(columns& other) {
+    ft::swap(_alloc, other._alloc);
+    ft::swap(_data, other._data);
+    _rest.swap(other._rest);
+  }
+};
+
+template <typename T, typename Alloc>
+struct columns<T, soa_fields<>, Alloc> {
+  explicit columns(const Alloc&) {}
+
+  static std::size_t row_size() { return 0; }
+  void allocate(std::size_t) {}
+  void deallocate(std::size_t) {}
+  void destroy(std::size_t, std::size_t) {}
+  void copy_from(const columns&, std::size_t) {}
+  void move_from(columns&, std::size_t) {}
+  void gather_from(const columns&, const std::size_t*, std::size_t) {}
+  void construct(std::size_t, const T&) {}
+  void construct_n(std::size_t, std::size_t, const T&) {}
+  void assign(std::size_t, const T&) {}
+  void load(std::size_t, T&) const {}
+  void shift_up(std::size_t, std::size_t) {}
+  void close_gap(std::size_t, std::size_t, std::size_t) {}
+  bool equal(const columns&, std::size_t) const { return true; }
+  void swap(columns&) {}
+};
+
+// Projects a (key, row) pair onto its key for ft::radix_sort.
+template <typename Key>
+struct rank_key {
+  typedef Key result_type;
+  template <typename Pair>
+  Key operator()(const Pair& p) const { return p.first; }
+};
+
+template <bool B>
+struct tag {};
+
+// Integer keys are radix sorted, stable by construction. Anything else is
+// compared with the row as tie-break, which keeps equal keys in order too.
+template <typename Ranked>
+void sort_ranked(Ranked& ranked, tag<true>) {
+  typedef typename Ranked::value_type::first_type key_type;
+  ft::radix_sort(ranked.begin(), ranked.end(), rank_key<key_type>());
+}
+
+template <typename Ranked>
+void sort_ranked(Ranked& ranked, tag<false>) {
+  std::sort(ranked.begin(), ranked.end());
+}
+
+template <typename Key>
+struct radix_sortable {
+  static const bool value = std::numeric_limits<Key>::is_integer;
+};
+
+template <>
+struct radix_sortable<bool> {
+  static const bool value = false;
+};
+
+template <typename Columns, std::size_t I>
+struct column_at {
+  typedef column_at<typename Columns::rest_type, I - 1> next;
+  typedef typename next::type                          type;
+
+  static type* get(const Columns& c) { return next::get(c._rest); }
+};
+
+template <typename Columns>
+struct column_at<Columns, 0> {
+  typedef typename Columns::field_type type;
+
+  static type* get(const Columns& c) { return c._data; }
+};
+
+} // namespace _soa
+
+template <typename T, typename Alloc = std::allocator<T> >
+class soa_vector {
+private:
+  typedef typename soa_traits<T>::fields        fields;
+  typedef _soa::columns<T, fields, Alloc>       columns_type;
+
+public:
+  typedef T           value_type;
+  typedef Alloc       allocator_type;
+  typedef std::size_t size_type;
+  typedef T           const_reference;
+
+  static const size_type field_count = fields::count;
+
+  template <size_type I>
+  struct field_type {
+    typedef typename _soa::column_at<columns_type, I>::type type;
+  };
+
+  // Stands for row i: converts to T, assigns from T, and reaches one field
+  // in place with get<I>().
+  class reference {
+  public:
+    operator T() const { return _owner->load(_index); }
+
+    reference& operator=(const T& value) {
+      _owner->_columns.assign(_index, value);
+      return *this;
+    }
+
+    reference& operator=(const reference& x) { return *this = T(x); }
+
+    template <size_type I>
+    typename field_type<I>::type& get() const {
+      return _soa::column_at<columns_type, I>::get(_owner->_columns)[_index];
+    }
+
+  private:
+    friend class soa_vector;
+
+    soa_vector* _owner;
+    size_type   _index;
+
+    reference(soa_vector* owner, size_type index) : _owner(owner), _index(index) {}
+  };
+
+private:
+  allocator_type _alloc;
+  columns_type   _columns;
+  size_type      _size;
+  size_type      _capacity;
+
+  friend class reference;
+
+  T load(size_type i) const {
+    T value;
+    _columns.load(i, value);
+    return value;
+  }
+
+  // Swaps in fresh columns of n slots holding the current rows.
+  void reallocate(size_type n) {
+    columns_type fresh(_alloc);
+    fresh.allocate(n);
+    try {
+      fresh.move_from(_columns, _size);
+    } catch (...) {
+      fresh.deallocate(n);
+      throw;
+    }
+    _columns.destroy(0, _size);
+    _columns.deallocate(_capacity);
+    _columns.swap(fresh);
+    _capacity = n;
+  }
+
+  void ensure_capacity(size_type min_capacity) {
+    if (min_capacity > _capacity)
+      reserve(ft::growth_doubling::next_capacity(_capacity, min_capacity, max_size(),
+                                                 columns_type::row_size()));
+  }
+
+  void check(size_type pos, const char* what) const {
+    if (pos >= _size)
+      throw ft::out_of_range(what);
+  }
+
+public:
+  explicit soa_vector(const allocator_type& alloc = allocator_type())
+    : _alloc(alloc), _columns(alloc), _size(0), _capacity(0) {}
+
+  explicit soa_vector(size_type n, const T& value = T(),
+                      const allocator_type& alloc = allocator_type())
+    : _alloc(alloc), _columns(alloc), _size(0), _capacity(0) {
+    resize(n, value);
+  }
+
+  soa_vector(const soa_vector& x)
+    : _alloc(x._alloc), _columns(x._alloc), _size(0), _capacity(0) {
+    if (!x._size)
+      return;
+    _columns.allocate(x._size);
+    try {
+      _columns.copy_from(x._columns, x._size);
+    } catch (...) {
+      _columns.deallocate(x._size);
+      throw;
+    }
+    _size = _capacity = x._size;
+  }
+
+  ~soa_vector() {
+    _columns.destroy(0, _size);
+    _columns.deallocate(_capacity);
+  }
+
+  soa_vector& operator=(const soa_vector& x) {
+    if (this != &x) {
+      soa_vector tmp(x);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  size_type size() const { return _size; }
+  bool empty() const { return _size == 0; }
+  size_type capacity() const { return _capacity; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / (columns_type::row_size() ? columns_type::row_size() : 1);
+  }
+  allocator_type get_allocator() const { return _alloc; }
+
+  void reserve(size_type n) {
+    if (n <= _capacity)
+      return;
+    if (n > max_size())
+      throw ft::length_error("soa_vector: n exceeds max_size");
+    reallocate(n);
+  }
+
+  void shrink_to_fit() {
+    if (_capacity != _size)
+      reallocate(_size);
+  }
+
+  void resize(size_type n, const T& value = T()) {
+    if (n < _size) {
+      _columns.destroy(n, _size);
+    } else if (n > _size) {
+      ensure_capacity(n);
+      _columns.construct_n(_size, n - _size, value);
+    }
+    _size = n;
+  }
+
+  void clear() {
+    _columns.destroy(0, _size);
+    _size = 0;
+  }
+
+  // Element access
+  reference operator[](size_type i) { return reference(this, i); }
+  const_reference operator[](size_type i) const { return load(i); }
+
+  reference at(size_type i) {
+    check(i, "soa_vector::at");
+    return reference(this, i);
+  }
+
+  const_reference at(size_type i) const {
+    check(i, "soa_vector::at");
+    return load(i);
+  }
+
+  reference front() { return reference(this, 0); }
+  const_reference front() const { return load(0); }
+  reference back() { return reference(this, _size - 1); }
+  const_reference back() const { return load(_size - 1); }
+
+  // Column I: field I of every element, contiguous.
+  template <size_type I>
+  field_span<typename field_type<I>::type> field() {
+    return field_span<typename field_type<I>::type>(_soa::column_at<columns_type, I>::get(_columns), _size);
+  }
+
+  template <size_type I>
+  field_span<const typename field_type<I>::type> field() const {
+    return field_span<const typename field_type<I>::type>(_soa::column_at<columns_type, I>::get(_columns), _size);
+  }
+
+  // Modifiers
+  void push_back(const T& value) {
+    ensure_capacity(_size + 1);
+    _columns.construct(_size, value);
+    ++_size;
+  }
+
+  void pop_back() {
+    _columns.destroy(_size - 1, _size);
+    --_size;
+  }
+
+  // Inserts value before row pos.
+  void insert(size_type pos, const T& value) {
+    if (pos > _size)
+      throw ft::out_of_range("soa_vector::insert");
+    if (pos == _size)
+      return push_back(value);
+    T copy(value);  // value may be a row of this vector
+    ensure_capacity(_size + 1);
+    _columns.shift_up(pos, _size);
+    ++_size;
+    _columns.assign(pos, copy);
+  }
+
+  void erase(size_type pos) { erase(pos, pos + 1); }
+
+  // Removes rows [first, last).
+  void erase(size_type first, size_type last) {
+    if (first > last || last > _size)
+      throw ft::out_of_range("soa_vector::erase");
+    if (first == last)
+      return;
+    _columns.close_gap(first, last, _size);
+    _size -= last - first;
+  }
+
+  // Stable sort of the rows by field I, then a single gather per column.
+  template <size_type I>
+  void sort_by() {
+    typedef typename field_type<I>::type key_type;
+    if (_size < 2)
+      return;
+    const key_type* keys = _soa::column_at<columns_type, I>::get(_columns);
+    ft::vector<std::pair<key_type, size_type> > ranked;
+    ranked.reserve(_size);
+    for (size_type i = 0; i < _size; ++i)
+      ranked.push_back(std::make_pair(keys[i], i));
+    _soa::sort_ranked(ranked, _soa::tag<_soa::radix_sortable<key_type>::value>());
+    ft::vector<size_type> order(_size);
+    for (size_type i = 0; i < _size; ++i)
+      order[i] = ranked[i].second;
+
+    columns_type sorted(_alloc);
+    sorted.allocate(_capacity);
+    try {
+      sorted.gather_from(_columns, &order[0], _size);
+    } catch (...) {
+      sorted.deallocate(_capacity);
+      throw;
+    }
+    _columns.destroy(0, _size);
+    _columns.deallocate(_capacity);
+    _columns.swap(sorted);
+  }
+
+  void swap(soa_vector& other) {
+    ft::swap(_alloc, other._alloc);
+    _columns.swap(other._columns);
+    ft::swap(_size, other._size);
+    ft::swap(_capacity, other._capacity);
+  }
+
+  friend bool operator==(const soa_vector& x, const soa_vector& y) {
+    return x._size == y._size && x._columns.equal(y._columns, x._size);
+  }
+};
+
+template <typename T, typename Alloc>
+const typename soa_vector<T, Alloc>::size_type soa_vector<T, Alloc>::field_count;
+
+template <typename T, typename Alloc>
+bool operator!=(const soa_vector<T, Alloc>& x, const soa_vector<T, Alloc>& y) {
+  return !(x == y);
+}
+
+template <typename T, typename Alloc>
+void swap(soa_vector<T, Alloc>& x, soa_vector<T, Alloc>& y) {
+  x.swap(y);
+}
+
+} // namespace ft
+
+#endif // FT_SOA_VECTOR_HPP
@@ -0,0 +1,411 @@
+// Vector with a fixed capacity of N elements stored inside the object. It
+// never allocates; growing past N throws ft::length_error. The layout
+// follows T: trivially copyable T gives a trivially copyable static_vector,
+// and under C++14 trivial T is kept in a plain array so the container can
+// be used in constant expressions.
+
+#ifndef FT_STATIC_VECTOR_HPP
+#define FT_STATIC_VECTOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <limits>
+#include <algorithm>
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
+#include "exception.hpp"
+#include "utils/swap.hpp"
+#include "utils/enable_if.hpp"
+#include "utils/simd.hpp"
+#include "iterators/random_access_iterator.hpp"
+#include "iterators/reverse_iterator.hpp"
+
+#if __cplusplus >= 201402L
+# define FT_STATIC_VECTOR_CONSTEXPR constexpr
+#else
+# define FT_STATIC_VECTOR_CONSTEXPR
+#endif
+
+namespace ft {
+
+namespace _static_vector {
+
+enum storage_kind {
+  STORAGE_GENERIC,  // raw slots, explicit copy and destruction
+  STORAGE_TRIVIAL,  // raw slots, implicit (bitwise) copy
+  STORAGE_LITERAL   // T[N], usable in constant expressions
+};
+
+template <typename T>
+struct kind_of {
+#if __cplusplus >= 201103L
+  static const bool trivial = std::is_trivially_copyable<T>::value &&
+                              std::is_trivially_destructible<T>::value;
+# if __cplusplus >= 201402L
+  static const int value = trivial && std::is_trivially_default_constructible<T>::value
+                             ? STORAGE_LITERAL
+                             : trivial ? STORAGE_TRIVIAL : STORAGE_GENERIC;
+# else
+  static const int value = trivial ? STORAGE_TRIVIAL : STORAGE_GENERIC;
+# endif
+#else
+  static const int value = std::numeric_limits<T>::is_specialized ? STORAGE_TRIVIAL : STORAGE_GENERIC;
+#endif
+};
+
+// Uninitialized slots for N elements, aligned for T
+template <typename T, std::size_t N>
+struct raw_slots {
+#if __cplusplus >= 201103L
+  alignas(T) unsigned char bytes[(N ? N : 1) * sizeof(T)];
+#else
+  union {
+    unsigned char bytes[(N ? N : 1) * sizeof(T)];
+    long double   align_float;
+    long long     align_int;
+    void*         align_pointer;
+  };
+#endif
+
+  T* ptr() { return reinterpret_cast<T*>(bytes); }
+  const T* ptr() const { return reinterpret_cast<const T*>(bytes); }
+};
+
+template <typename T, std::size_t N, int Kind = kind_of<T>::value>
+struct storage {
+  raw_slots<T, N> _slots;
+  std::size_t     _size;
+
+  storage() : _size(0) {}
+
+  storage(const storage& x) : _size(0) {
+    for (; _size < x._size; ++_size)
+      construct(_size, x.ptr()[_size]);
+  }
+
+  storage& operator=(const storage& x) {
+    if (this != &x) {
+      std::size_t common = std::min(_size, x._size);
+      for (std::size_t i = 0; i < common; ++i)
+        ptr()[i] = x.ptr()[i];
+      for (std::size_t i = common; i < x._size; ++i)
+        construct(i, x.ptr()[i]);
+      for (std::size_t i = x._size; i < _size; ++i)
+        destroy(i);
+      _size = x._size;
+    }
+    return *this;
+  }
+
+  ~storage() {
+    for (std::size_t i = 0; i < _size; ++i)
+      destroy(i);
+  }
+
+  T* ptr() { return _slots.ptr(); }
+  const T* ptr() const { return _slots.ptr(); }
+  void construct(std::size_t i, const T& val) { ::new (static_cast<void*>(ptr() + i)) T(val); }
+  void destroy(std::size_t i) { ptr()[i].~T(); }
+};
+
+// Copy and destruction left implicit, so they stay trivial
+template <typename T, std::size_t N>
+struct storage<T, N, STORAGE_TRIVIAL> {
+  raw_slots<T, N> _slots;
+  std::size_t     _size;
+
+  storage() : _size(0) {}
+
+  T* ptr() { return _slots.ptr(); }
+  const T* ptr() const { return _slots.ptr(); }
+  void construct(std::size_t i, const T& val) { ::new (static_cast<void*>(ptr() + i)) T(val); }
+  void destroy(std::size_t) {}
+};
+
+#if __cplusplus >= 201402L
+// Constant evaluation cannot reinterpret raw bytes, so elements live in a
+// value-initialized array and are written by assignment.
+template <typename T, std::size_t N>
+struct storage<T, N, STORAGE_LITERAL> {
+  T           _elems[N ? N : 1];
+  std::size_t _size;
+
+  constexpr storage() : _elems(), _size(0) {}
+
+  constexpr T* ptr() { return _elems; }
+  constexpr const T* ptr() const { return _elems; }
+  constexpr void construct(std::size_t i, const T& val) { _elems[i] = val; }
+  constexpr void destroy(std::size_t) {}
+};
+#endif
+
+} // namespace _static_vector
+
+template <typename T, std::size_t N>
+class static_vector {
+public:
+  typedef T                                       value_type;
+  typedef T&                                      reference;
+  typedef const T&                                const_reference;
+  typedef T*                                      pointer;
+  typedef const T*                                const_pointer;
+  typedef std::size_t                             size_type;
+  typedef std::ptrdiff_t                          difference_type;
+
+  typedef ft::random_access_iterator<T>           iterator;
+  typedef ft::random_access_iterator<const T>     const_iterator;
+  typedef ft::reverse_iterator<iterator>          reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+  static const size_type static_capacity = N;
+
+private:
+  // The only data member: copy, assignment and destruction are storage's
+  _static_vector::storage<T, N> _s;
+
+  FT_STATIC_VECTOR_CONSTEXPR void check_room(size_type n, const char* what) const {
+    if (n > N)
+      throw ft::length_error(what);
+  }
+
+  void destroy_from(size_type n) {
+    for (size_type i = n; i < _s._size; ++i)
+      _s.destroy(i);
+    _s._size = n;
+  }
+
+  // Shifts [index, size) up by n slots, leaving them unconstructed.
+  void open_gap(size_type index, size_type n) {
+    check_room(_s._size + n, "static_vector::insert: capacity exceeded");
+    for (size_type i = _s._size; i > index; --i) {
+      _s.construct(i + n - 1, _s.ptr()[i - 1]);
+      _s.destroy(i - 1);
+    }
+  }
+
+  size_type truncate(pointer new_end) {
+    size_type removed = (data() + _s._size) - new_end;
+    destroy_from(_s._size - removed);
+    return removed;
+  }
+
+public:
+  FT_STATIC_VECTOR_CONSTEXPR static_vector() {}
+
+  explicit static_vector(size_type n, const value_type& val = value_type()) {
+    assign(n, val);
+  }
+
+  template <typename InputIterator>
+  static_vector(InputIterator first, InputIterator last,
+                typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+    assign(first, last);
+  }
+
+  // Iterators
+  iterator begin() { return iterator(data()); }
+  const_iterator begin() const { return const_iterator(data()); }
+  iterator end() { return iterator(data() + _s._size); }
+  const_iterator end() const { return const_iterator(data() + _s._size); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  // Capacity
+  FT_STATIC_VECTOR_CONSTEXPR size_type size() const { return _s._size; }
+  FT_STATIC_VECTOR_CONSTEXPR size_type max_size() const { return N; }
+  FT_STATIC_VECTOR_CONSTEXPR size_type capacity() const { return N; }
+  FT_STATIC_VECTOR_CONSTEXPR bool empty() const { return _s._size == 0; }
+  FT_STATIC_VECTOR_CONSTEXPR bool full() const { return _s._size == N; }
+
+  void resize(size_type n, value_type val = value_type()) {
+    check_room(n, "static_vector::resize: capacity exceeded");
+    if (n < _s._size)
+      destroy_from(n);
+    for (; _s._size < n; ++_s._size)
+      _s.construct(_s._size, val);
+  }
+
+  // Only checks n: the storage is already there
+  void reserve(size_type n) const {
+    check_room(n, "static_vector::reserve: capacity exceeded");
+  }
+
+  // Element access
+  FT_STATIC_VECTOR_CONSTEXPR reference operator[](size_type n) { return _s.ptr()[n]; }
+  FT_STATIC_VECTOR_CONSTEXPR const_reference operator[](size_type n) const { return _s.ptr()[n]; }
+
+  FT_STATIC_VECTOR_CONSTEXPR reference at(size_type n) {
+    if (n >= _s._size)
+      throw ft::out_of_range("static_vector::at");
+    return _s.ptr()[n];
+  }
+
+  FT_STATIC_VECTOR_CONSTEXPR const_reference at(size_type n) const {
+    if (n >= _s._size)
+      throw ft::out_of_range("static_vector::at");
+    return _s.ptr()[n];
+  }
+
+  FT_STATIC_VECTOR_CONSTEXPR reference front() { return _s.ptr()[0]; }
+  FT_STATIC_VECTOR_CONSTEXPR const_reference front() const { return _s.ptr()[0]; }
+  FT_STATIC_VECTOR_CONSTEXPR reference back() { return _s.ptr()[_s._size - 1]; }
+  FT_STATIC_VECTOR_CONSTEXPR const_reference back() const { return _s.ptr()[_s._size - 1]; }
+  FT_STATIC_VECTOR_CONSTEXPR pointer data() { return _s.ptr(); }
+  FT_STATIC_VECTOR_CONSTEXPR const_pointer data() const { return _s.ptr(); }
+
+  // Modifiers
+  template <class InputIterator>
+  void assign(InputIterator first, InputIterator last,
+              typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+    clear();
+    for (; first != last; ++first)
+      push_back(*first);
+  }
+
+  void assign(size_type n, const value_type& val) {
+    check_room(n, "static_vector::assign: capacity exceeded");
+    value_type value(val);  // val may live in this vector
+    clear();
+    for (; _s._size < n; ++_s._size)
+      _s.construct(_s._size, value);
+  }
+
+  iterator insert(iterator position, const value_type& val) {
+    size_type index = position - begin();
+    value_type value(val);
+    open_gap(index, 1);
+    _s.construct(index, value);
+    ++_s._size;
+    return iterator(data() + index);
+  }
+
+  void insert(iterator position, size_type n, const value_type& val) {
+    if (n == 0) return;
+    size_type index = position - begin();
+    value_type value(val);
+    open_gap(index, n);
+    for (size_type i = 0; i < n; ++i)
+      _s.construct(index + i, value);
+    _s._size += n;
+  }
+
+  template <class InputIterator>
+  void insert(iterator position, InputIterator first, InputIterator last,
+              typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+    size_type index = position - begin();
+    static_vector temp(first, last);
+    if (temp.empty()) return;
+    open_gap(index, temp.size());
+    for (size_type i = 0; i < temp.size(); ++i)
+      _s.construct(index + i, temp[i]);
+    _s._size += temp.size();
+  }
+
+  iterator erase(iterator position) {
+    return erase(position, position + 1);
+  }
+
+  iterator erase(iterator first, iterator last) {
+    if (first == last) return first;
+    size_type start = first - begin();
+    size_type count = last - first;
+    for (size_type i = start; i + count < _s._size; ++i)
+      _s.ptr()[i] = _s.ptr()[i + count];
+    destroy_from(_s._size - count);
+    return iterator(data() + start);
+  }
+
+  // One-pass compaction as in ft::vector; each returns the number removed.
+  template <typename Predicate>
+  size_type erase_if(Predicate pred) {
+    return truncate(_simd::dispatch<T>::remove_if(data(), data() + _s._size, pred));
+  }
+
+  size_type remove(const value_type& val) {
+    value_type value(val);
+    return truncate(_simd::dispatch<T>::remove(data(), data() + _s._size, value));
+  }
+
+  size_type unique() {
+    return truncate(_simd::dispatch<T>::unique(data(), data() + _s._size));
+  }
+
+  FT_STATIC_VECTOR_CONSTEXPR void push_back(const value_type& val) {
+    check_room(_s._size + 1, "static_vector::push_back: capacity exceeded");
+    _s.construct(_s._size, val);
+    ++_s._size;
+  }
+
+  FT_STATIC_VECTOR_CONSTEXPR void pop_back() {
+    if (_s._size > 0)
+      _s.destroy(--_s._size);
+  }
+
+  FT_STATIC_VECTOR_CONSTEXPR void clear() {
+    while (_s._size > 0)
+      _s.destroy(--_s._size);
+  }
+
+  // Swaps the common prefix and relocates the longer tail.
+  void swap(static_vector& other) {
+    static_vector& longer = size() >= other.size() ? *this : other;
+    static_vector& shorter = size() >= other.size() ? other : *this;
+    for (size_type i = 0; i < shorter.size(); ++i)
+      ft::swap(_s.ptr()[i], other._s.ptr()[i]);
+    size_type keep = shorter.size();
+    for (size_type i = keep; i < longer.size(); ++i)
+      shorter._s.construct(i, longer._s.ptr()[i]);
+    shorter._s._size = longer.size();
+    longer.destroy_from(keep);
+  }
+};
+
+template <typename T, std::size_t N>
+const typename static_vector<T, N>::size_type static_vector<T, N>::static_capacity;
+
+// Non-member swap
+template <typename T, std::size_t N>
+void swap(static_vector<T, N>& x, static_vector<T, N>& y) {
+  x.swap(y);
+}
+
+// Relational operators
+template <typename T, std::size_t N>
+bool operator==(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return _simd::dispatch<T>::equal(lhs.data(), rhs.data(), lhs.size());
+}
+
+template <typename T, std::size_t N>
+bool operator!=(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N>
+bool operator<(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs) {
+  return _simd::dispatch<T>::less(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+}
+
+template <typename T, std::size_t N>
+bool operator<=(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, std::size_t N>
+bool operator>(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, std::size_t N>
+bool operator>=(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs) {
+  return !(lhs < rhs);
+}
+
+} // namespace ft
+
+#undef FT_STATIC_VECTOR_CONSTEXPR
+
+#endif // FT_STATIC_VECTOR_HPP
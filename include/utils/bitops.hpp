@@ -0,0 +1,287 @@
+// Word-wise kernels over arrays of bit blocks: population count, the first
+// non-zero block, and bulk AND / OR / XOR / AND-NOT / NOT. Like the search
+// kernels in simd.hpp they are picked at runtime and capped by
+// set_simd_level: AVX2 counts with a nibble lookup table (after Mula), the
+// SSE2 level with the popcnt instruction when the CPU has it, and the
+// scalar level with the compiler's generic popcount.
+
+#ifndef FT_BITOPS_HPP
+#define FT_BITOPS_HPP
+
+#include <cstddef>
+#include <climits>
+#include "utils/simd.hpp"
+
+#if FT_SIMD_X86
+# define FT_TARGET_POPCNT __attribute__((target("popcnt")))
+# define FT_TARGET_AVX2_POPCNT __attribute__((target("avx2,popcnt")))
+#endif
+
+namespace ft {
+
+namespace _bits {
+
+typedef unsigned long word;
+
+static const std::size_t word_bits = sizeof(word) * CHAR_BIT;
+
+inline std::size_t popcount_scalar(word x) {
+#if defined(__GNUC__)
+  return __builtin_popcountl(x);
+#else
+  std::size_t n = 0;
+  for (; x; x &= x - 1)
+    ++n;
+  return n;
+#endif
+}
+
+// Index of the lowest set bit; x must not be zero.
+inline std::size_t lowest_bit(word x) {
+#if defined(__GNUC__)
+  return __builtin_ctzl(x);
+#else
+  std::size_t i = 0;
+  for (; !(x & 1); x >>= 1)
+    ++i;
+  return i;
+#endif
+}
+
+inline std::size_t count_scalar(const word* p, std::size_t n) {
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < n; ++i)
+    total += popcount_scalar(p[i]);
+  return total;
+}
+
+inline std::size_t find_scalar(const word* p, std::size_t n) {
+  std::size_t i = 0;
+  while (i < n && !p[i])
+    ++i;
+  return i;
+}
+
+struct and_op {
+  static word apply(word a, word b) { return a & b; }
+#if FT_SIMD_X86
+  FT_TARGET_SSE2 static __m128i apply(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+  FT_TARGET_AVX2 static __m256i apply(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+#endif
+};
+
+struct or_op {
+  static word apply(word a, word b) { return a | b; }
+#if FT_SIMD_X86
+  FT_TARGET_SSE2 static __m128i apply(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+  FT_TARGET_AVX2 static __m256i apply(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+#endif
+};
+
+struct xor_op {
+  static word apply(word a, word b) { return a ^ b; }
+#if FT_SIMD_X86
+  FT_TARGET_SSE2 static __m128i apply(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+  FT_TARGET_AVX2 static __m256i apply(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+#endif
+};
+
+// a & ~b
+struct andnot_op {
+  static word apply(word a, word b) { return a & ~b; }
+#if FT_SIMD_X86
+  FT_TARGET_SSE2 static __m128i apply(__m128i a, __m128i b) { return _mm_andnot_si128(b, a); }
+  FT_TARGET_AVX2 static __m256i apply(__m256i a, __m256i b) { return _mm256_andnot_si256(b, a); }
+#endif
+};
+
+template <typename Op>
+void combine_scalar(word* dst, const word* src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i)
+    dst[i] = Op::apply(dst[i], src[i]);
+}
+
+inline void complement_scalar(word* p, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i)
+    p[i] = ~p[i];
+}
+
+#if FT_SIMD_X86
+
+inline bool has_popcnt() {
+  static const bool supported = __builtin_cpu_supports("popcnt");
+  return supported;
+}
+
+// Four independent sums so consecutive popcnts do not wait on each other.
+FT_TARGET_POPCNT inline std::size_t count_popcnt(const word* p, std::size_t n) {
+  std::size_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += __builtin_popcountl(p[i]);
+    s1 += __builtin_popcountl(p[i + 1]);
+    s2 += __builtin_popcountl(p[i + 2]);
+    s3 += __builtin_popcountl(p[i + 3]);
+  }
+  for (; i < n; ++i)
+    s0 += __builtin_popcountl(p[i]);
+  return s0 + s1 + s2 + s3;
+}
+
+// Each byte's count is the sum of two nibble lookups; byte counts are
+// summed into 64-bit lanes with a SAD against zero. The per-byte tallies
+// can reach 8 per vector, so they are folded every 31 vectors.
+FT_TARGET_AVX2_POPCNT inline std::size_t count_avx2(const word* p, std::size_t n) {
+  const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low = _mm256_set1_epi8(0x0f);
+  const std::size_t step = 32 / sizeof(word);
+  __m256i total = _mm256_setzero_si256();
+  std::size_t i = 0;
+  while (i + step <= n) {
+    __m256i tally = _mm256_setzero_si256();
+    for (std::size_t k = 0; k < 31 && i + step <= n; ++k, i += step) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+      __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(x, low));
+      __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(x, 4), low));
+      tally = _mm256_add_epi8(tally, _mm256_add_epi8(lo, hi));
+    }
+    total = _mm256_add_epi64(total, _mm256_sad_epu8(tally, _mm256_setzero_si256()));
+  }
+  unsigned long long lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), total);
+  std::size_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  for (; i < n; ++i)
+    sum += __builtin_popcountl(p[i]);
+  return sum;
+}
+
+FT_TARGET_SSE2 inline std::size_t find_sse2(const word* p, std::size_t n) {
+  const std::size_t step = 16 / sizeof(word);
+  const __m128i zero = _mm_setzero_si128();
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero)) != 0xFFFF)
+      break;
+  }
+  return i + find_scalar(p + i, n - i);
+}
+
+FT_TARGET_AVX2 inline std::size_t find_avx2(const word* p, std::size_t n) {
+  const std::size_t step = 32 / sizeof(word);
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    if (!_mm256_testz_si256(x, x))
+      break;
+  }
+  return i + find_scalar(p + i, n - i);
+}
+
+template <typename Op>
+FT_TARGET_SSE2 void combine_sse2(word* dst, const word* src, std::size_t n) {
+  const std::size_t step = 16 / sizeof(word);
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::apply(a, b));
+  }
+  combine_scalar<Op>(dst + i, src + i, n - i);
+}
+
+template <typename Op>
+FT_TARGET_AVX2 void combine_avx2(word* dst, const word* src, std::size_t n) {
+  const std::size_t step = 32 / sizeof(word);
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::apply(a, b));
+  }
+  combine_scalar<Op>(dst + i, src + i, n - i);
+}
+
+FT_TARGET_SSE2 inline void complement_sse2(word* p, std::size_t n) {
+  const std::size_t step = 16 / sizeof(word);
+  const __m128i ones = _mm_set1_epi32(-1);
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_xor_si128(x, ones));
+  }
+  complement_scalar(p + i, n - i);
+}
+
+FT_TARGET_AVX2 inline void complement_avx2(word* p, std::size_t n) {
+  const std::size_t step = 32 / sizeof(word);
+  const __m256i ones = _mm256_set1_epi32(-1);
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_xor_si256(x, ones));
+  }
+  complement_scalar(p + i, n - i);
+}
+
+#endif // FT_SIMD_X86
+
+// Number of set bits in p[0, n).
+inline std::size_t count(const word* p, std::size_t n) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2 && has_popcnt())
+    return count_avx2(p, n);
+  if (level >= SIMD_SSE2 && has_popcnt())
+    return count_popcnt(p, n);
+#endif
+  return count_scalar(p, n);
+}
+
+// Index of the first non-zero word in p[0, n), or n.
+inline std::size_t find_nonzero(const word* p, std::size_t n) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2)
+    return find_avx2(p, n);
+  if (level >= SIMD_SSE2)
+    return find_sse2(p, n);
+#endif
+  return find_scalar(p, n);
+}
+
+// dst[i] = Op(dst[i], src[i]) for i in [0, n).
+template <typename Op>
+void combine(word* dst, const word* src, std::size_t n) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2)
+    return combine_avx2<Op>(dst, src, n);
+  if (level >= SIMD_SSE2)
+    return combine_sse2<Op>(dst, src, n);
+#endif
+  combine_scalar<Op>(dst, src, n);
+}
+
+inline void complement(word* p, std::size_t n) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2)
+    return complement_avx2(p, n);
+  if (level >= SIMD_SSE2)
+    return complement_sse2(p, n);
+#endif
+  complement_scalar(p, n);
+}
+
+} // namespace _bits
+
+} // namespace ft
+
+#if FT_SIMD_X86
+# undef FT_TARGET_POPCNT
+# undef FT_TARGET_AVX2_POPCNT
+#endif
+
+#endif // FT_BITOPS_HPP
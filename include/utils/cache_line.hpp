@@ -0,0 +1,13 @@
+#ifndef FT_CACHE_LINE_HPP
+#define FT_CACHE_LINE_HPP
+
+#include <cstddef>
+
+namespace ft {
+
+// Destructive interference size assumed by padded layouts (x86-64, most ARM).
+static const std::size_t cache_line_size = 64;
+
+} // namespace ft
+
+#endif // FT_CACHE_LINE_HPP
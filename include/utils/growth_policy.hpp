@@ -0,0 +1,56 @@
+#ifndef FT_GROWTH_POLICY_HPP
+#define FT_GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+namespace ft {
+
+// Growth policies for ft::vector. next_capacity returns the capacity to
+// reallocate to when an insertion needs min_capacity slots and capacity is
+// full; the result is at least min_capacity and never more than max.
+
+// Doubling: fewest reallocations, up to 50% slack.
+struct growth_doubling {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t min_capacity,
+                                   std::size_t max, std::size_t /* elem_size */) {
+    std::size_t grown = capacity > max / 2 ? max : capacity * 2;
+    return grown > min_capacity ? grown : min_capacity;
+  }
+};
+
+// 1.5x: at most a third slack, and freed blocks can eventually be reused
+// for a later, larger request.
+struct growth_one_and_half {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t min_capacity,
+                                   std::size_t max, std::size_t /* elem_size */) {
+    std::size_t grown = capacity > max / 3 * 2 ? max : capacity + capacity / 2;
+    return grown > min_capacity ? grown : min_capacity;
+  }
+};
+
+// 1.5x, then rounded up to fill the malloc size class the request lands
+// in. Classes follow jemalloc: multiples of 16 bytes up to 128, then four
+// per power of two. Each is a multiple of glibc's 16-byte chunk step, so
+// the bytes the allocator would waste become usable capacity instead.
+struct growth_size_class {
+  static std::size_t size_class(std::size_t bytes) {
+    if (bytes <= 128)
+      return (bytes + 15) & ~static_cast<std::size_t>(15);
+    // (2^k, 2^(k+1)] is split into four classes 2^(k-2) bytes apart
+    std::size_t step = 32;
+    while (step * 8 < bytes)
+      step *= 2;
+    return (bytes + step - 1) / step * step;
+  }
+
+  static std::size_t next_capacity(std::size_t capacity, std::size_t min_capacity,
+                                   std::size_t max, std::size_t elem_size) {
+    std::size_t grown = growth_one_and_half::next_capacity(capacity, min_capacity, max, elem_size);
+    std::size_t rounded = size_class(grown * elem_size) / elem_size;
+    return rounded < max ? rounded : max;
+  }
+};
+
+} // namespace ft
+
+#endif // FT_GROWTH_POLICY_HPP
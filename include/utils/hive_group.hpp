@@ -0,0 +1,64 @@
+#ifndef FT_HIVE_GROUP_HPP
+#define FT_HIVE_GROUP_HPP
+
+#include <cstddef>
+
+namespace ft {
+
+// One element block of an ft::hive. Slots [0, last) have been used; those
+// erased since form runs ("skipblocks") recorded in the skipfield, and the
+// runs are chained into a free list through the dead slots themselves.
+//
+// The skipfield is the low-complexity jump-counting kind: the first and
+// last entry of a run both hold its length, every live slot holds 0, so
+// an iterator steps over a whole run with one read. It has one extra
+// trailing 0 so the slot past the end can be read like any other.
+template <typename T>
+struct hive_group {
+  typedef unsigned short skip_type;
+
+  static const skip_type none = static_cast<skip_type>(-1);
+
+  // Prev / next run starts in this group's free list
+  struct free_links {
+    skip_type prev;
+    skip_type next;
+  };
+
+  // An element, or free list links once erased. Before C++11 only the
+  // alignment of the scalar types is available, which over-aligned T may
+  // exceed; the slots' allocator must also honour alignof(slot).
+  union slot {
+#if __cplusplus >= 201103L
+    alignas(T) char bytes[sizeof(T)];
+    free_links      links;
+#else
+    char        bytes[sizeof(T)];
+    free_links  links;
+    long double align_float;
+    long long   align_int;
+    void*       align_pointer;
+#endif
+  };
+
+  slot*        elements;
+  skip_type*   skipfield;  // capacity + 1 entries
+  hive_group*  prev;       // iteration order
+  hive_group*  next;
+  hive_group*  prev_free;  // groups with erased slots
+  hive_group*  next_free;
+  std::size_t  capacity;
+  std::size_t  size;       // live elements
+  std::size_t  last;       // slots ever used
+  skip_type    free_head;  // first run start, or none
+
+  T* at(std::size_t i) { return reinterpret_cast<T*>(elements[i].bytes); }
+  const T* at(std::size_t i) const { return reinterpret_cast<const T*>(elements[i].bytes); }
+};
+
+template <typename T>
+const typename hive_group<T>::skip_type hive_group<T>::none;
+
+} // namespace ft
+
+#endif // FT_HIVE_GROUP_HPP
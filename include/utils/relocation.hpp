@@ -0,0 +1,56 @@
+#ifndef FT_RELOCATION_HPP
+#define FT_RELOCATION_HPP
+
+#include <cstddef>
+#include "utils/type_traits.hpp"
+
+namespace ft {
+
+// Types whose objects can be moved to a new address as raw bytes, leaving
+// nothing to destroy at the old one. Specialize for other types that hold
+// no pointers into themselves.
+template <typename T>
+struct is_trivially_relocatable {
+  static const bool value = is_trivially_copyable<T>::value;
+};
+
+// Allocators that can grow or shrink a block in place, or move it without
+// copying, through pointer reallocate(pointer p, size_type old_n, size_type new_n).
+// The contents of p survive up to min(old_n, new_n) elements.
+template <typename Alloc>
+struct allocator_reallocates {
+  static const bool value = false;
+};
+
+namespace _relocate {
+
+template <bool B>
+struct tag {};
+
+// The allocator's reallocate when both it and T allow it, otherwise a null
+// pointer so the caller falls back to copying element by element.
+template <typename Alloc>
+typename Alloc::pointer resize(Alloc& alloc, typename Alloc::pointer p, std::size_t old_n,
+                               std::size_t new_n, tag<true>) {
+  return alloc.reallocate(p, old_n, new_n);
+}
+
+template <typename Alloc>
+typename Alloc::pointer resize(Alloc&, typename Alloc::pointer, std::size_t, std::size_t, tag<false>) {
+  return typename Alloc::pointer();
+}
+
+template <typename Alloc>
+typename Alloc::pointer resize(Alloc& alloc, typename Alloc::pointer p, std::size_t old_n,
+                               std::size_t new_n) {
+  typedef typename Alloc::value_type value_type;
+  return resize(alloc, p, old_n, new_n,
+                tag<allocator_reallocates<Alloc>::value &&
+                    is_trivially_relocatable<value_type>::value>());
+}
+
+} // namespace _relocate
+
+} // namespace ft
+
+#endif // FT_RELOCATION_HPP
@@ -0,0 +1,652 @@
+// SSE2 / AVX2 kernels for searching, comparing and compacting contiguous
+// arrays of arithmetic values, picked at runtime from the CPU's features. On other
+// architectures and compilers every entry point runs the portable loop.
+
+#ifndef FT_SIMD_HPP
+#define FT_SIMD_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define FT_SIMD_X86 1
+# include <immintrin.h>
+# define FT_TARGET_SSE2 __attribute__((target("sse2")))
+# define FT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+# define FT_SIMD_X86 0
+#endif
+
+namespace ft {
+
+enum simd_level_type { SIMD_SCALAR = 0, SIMD_SSE2 = 1, SIMD_AVX2 = 2 };
+
+namespace _simd {
+
+inline int detect_level() {
+#if FT_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return SIMD_AVX2;
+  if (__builtin_cpu_supports("sse2"))
+    return SIMD_SSE2;
+#endif
+  return SIMD_SCALAR;
+}
+
+inline int& level_cap() {
+  static int cap = SIMD_AVX2;
+  return cap;
+}
+
+} // namespace _simd
+
+// Instruction set the kernels use: what the CPU supports, capped by
+// set_simd_level.
+inline int simd_level() {
+  static const int detected = _simd::detect_level();
+  return detected < _simd::level_cap() ? detected : _simd::level_cap();
+}
+
+// Caps the kernels at level, e.g. SIMD_SCALAR to time the portable loops.
+// Not synchronised; set it before searching from several threads.
+inline void set_simd_level(int level) {
+  _simd::level_cap() = level;
+}
+
+namespace _simd {
+
+// Lane kinds: integers compare bitwise by width, floating point types with
+// the ordered IEEE equality (so NaN != NaN and -0.0 == 0.0, as with ==).
+enum { LANE_NONE = 0, LANE_I8 = 1, LANE_I16 = 2, LANE_I32 = 4, LANE_I64 = 8,
+       LANE_F32 = 32, LANE_F64 = 64 };
+
+template <int Width> struct int_lane { static const int kind = LANE_NONE; };
+template <> struct int_lane<1> { static const int kind = LANE_I8; };
+template <> struct int_lane<2> { static const int kind = LANE_I16; };
+template <> struct int_lane<4> { static const int kind = LANE_I32; };
+template <> struct int_lane<8> { static const int kind = LANE_I64; };
+
+template <typename T> struct lane {
+  static const int  kind = LANE_NONE;
+  static const bool is_integral = false;
+};
+
+#define FT_SIMD_INTEGRAL_LANE(T) \
+  template <> struct lane<T> { \
+    static const int  kind = int_lane<sizeof(T)>::kind; \
+    static const bool is_integral = true; \
+  }
+FT_SIMD_INTEGRAL_LANE(char);
+FT_SIMD_INTEGRAL_LANE(signed char);
+FT_SIMD_INTEGRAL_LANE(unsigned char);
+FT_SIMD_INTEGRAL_LANE(short);
+FT_SIMD_INTEGRAL_LANE(unsigned short);
+FT_SIMD_INTEGRAL_LANE(int);
+FT_SIMD_INTEGRAL_LANE(unsigned int);
+FT_SIMD_INTEGRAL_LANE(long);
+FT_SIMD_INTEGRAL_LANE(unsigned long);
+FT_SIMD_INTEGRAL_LANE(long long);
+FT_SIMD_INTEGRAL_LANE(unsigned long long);
+#undef FT_SIMD_INTEGRAL_LANE
+
+template <> struct lane<float> {
+  static const int  kind = LANE_F32;
+  static const bool is_integral = false;
+};
+
+template <> struct lane<double> {
+  static const int  kind = LANE_F64;
+  static const bool is_integral = false;
+};
+
+// min/max kernels exist for 32-bit integers only.
+template <typename T> struct minmax_lane {
+  static const bool supported = false;
+  static const bool is_signed = false;
+};
+
+template <> struct minmax_lane<int> {
+  static const bool supported = true;
+  static const bool is_signed = true;
+};
+
+template <> struct minmax_lane<unsigned int> {
+  static const bool supported = true;
+  static const bool is_signed = false;
+};
+
+template <int Kind> struct kind_tag {};
+
+// Portable loops, also used for the tails of the vector loops
+template <typename T>
+const T* find_scalar(const T* first, const T* last, const T& value) {
+  for (; first != last; ++first)
+    if (*first == value)
+      return first;
+  return last;
+}
+
+template <typename T>
+std::size_t count_scalar(const T* first, const T* last, const T& value) {
+  std::size_t n = 0;
+  for (; first != last; ++first)
+    n += *first == value;
+  return n;
+}
+
+template <typename T>
+std::size_t mismatch_scalar(const T* a, const T* b, std::size_t n) {
+  std::size_t i = 0;
+  while (i < n && a[i] == b[i])
+    ++i;
+  return i;
+}
+
+template <typename T>
+const T* min_scalar(const T* first, const T* last) {
+  const T* best = first;
+  for (++first; first < last; ++first)
+    if (*first < *best)
+      best = first;
+  return best;
+}
+
+template <typename T>
+const T* max_scalar(const T* first, const T* last) {
+  const T* best = first;
+  for (++first; first < last; ++first)
+    if (*best < *first)
+      best = first;
+  return best;
+}
+
+// Stream compaction: every element is written to out, which only advances
+// past the ones that are kept, so the loops carry no data-dependent branch.
+// out may alias first; it never passes it.
+template <typename T, typename Predicate>
+T* remove_if_scalar(T* out, const T* first, const T* last, Predicate pred) {
+  for (; first != last; ++first) {
+    T x = *first;
+    *out = x;
+    out += !pred(x);
+  }
+  return out;
+}
+
+template <typename T>
+struct equal_to_value {
+  T value;
+  explicit equal_to_value(const T& v) : value(v) {}
+  bool operator()(const T& x) const { return x == value; }
+};
+
+// Keeps x unless it equals prev, the element before it in the input.
+template <typename T>
+T* unique_scalar(T* out, const T* first, const T* last, T prev) {
+  for (; first != last; ++first) {
+    T x = *first;
+    *out = x;
+    out += !(x == prev);
+    prev = x;
+  }
+  return out;
+}
+
+#if FT_SIMD_X86
+
+// Bit i of a movemask covers byte i; an element of Width bytes owns Width
+// consecutive bits.
+inline unsigned ctz(unsigned mask) { return __builtin_ctz(mask); }
+
+// Counting keeps one matched-byte tally per byte lane (subtracting the all-ones
+// compare result adds one) and folds the tallies before any lane can wrap.
+const std::size_t count_flush = 255;
+
+// SSE2
+
+FT_TARGET_SSE2 inline __m128i eq128(__m128i a, __m128i b, kind_tag<LANE_I8>) { return _mm_cmpeq_epi8(a, b); }
+FT_TARGET_SSE2 inline __m128i eq128(__m128i a, __m128i b, kind_tag<LANE_I16>) { return _mm_cmpeq_epi16(a, b); }
+FT_TARGET_SSE2 inline __m128i eq128(__m128i a, __m128i b, kind_tag<LANE_I32>) { return _mm_cmpeq_epi32(a, b); }
+FT_TARGET_SSE2 inline __m128i eq128(__m128i a, __m128i b, kind_tag<LANE_I64>) {
+  // No 64-bit compare before SSE4.1: both 32-bit halves must match
+  __m128i c = _mm_cmpeq_epi32(a, b);
+  return _mm_and_si128(c, _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+FT_TARGET_SSE2 inline __m128i eq128(__m128i a, __m128i b, kind_tag<LANE_F32>) {
+  return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+}
+FT_TARGET_SSE2 inline __m128i eq128(__m128i a, __m128i b, kind_tag<LANE_F64>) {
+  return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+}
+
+template <typename T>
+FT_TARGET_SSE2 __m128i splat128(const T& value) {
+  T lanes[16 / sizeof(T)];
+  for (std::size_t i = 0; i < 16 / sizeof(T); ++i)
+    lanes[i] = value;
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes));
+}
+
+template <typename T>
+FT_TARGET_SSE2 const T* find_sse2(const T* first, const T* last, const T& value) {
+  const std::size_t step = 16 / sizeof(T);
+  __m128i v = splat128(value);
+  for (; static_cast<std::size_t>(last - first) >= step; first += step) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    unsigned mask = _mm_movemask_epi8(eq128(x, v, kind_tag<lane<T>::kind>()));
+    if (mask)
+      return first + ctz(mask) / sizeof(T);
+  }
+  return find_scalar(first, last, value);
+}
+
+template <typename T>
+FT_TARGET_SSE2 std::size_t count_sse2(const T* first, const T* last, const T& value) {
+  const std::size_t step = 16 / sizeof(T);
+  __m128i v = splat128(value);
+  std::size_t bytes = 0;
+  while (static_cast<std::size_t>(last - first) >= step) {
+    std::size_t blocks = std::min<std::size_t>((last - first) / step, count_flush);
+    __m128i tally = _mm_setzero_si128();
+    for (; blocks; --blocks, first += step) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+      tally = _mm_sub_epi8(tally, eq128(x, v, kind_tag<lane<T>::kind>()));
+    }
+    __m128i sums = _mm_sad_epu8(tally, _mm_setzero_si128());
+    bytes += _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+  }
+  return bytes / sizeof(T) + count_scalar(first, last, value);
+}
+
+template <typename T>
+FT_TARGET_SSE2 std::size_t mismatch_sse2(const T* a, const T* b, std::size_t n) {
+  const std::size_t step = 16 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    unsigned mask = _mm_movemask_epi8(eq128(x, y, kind_tag<lane<T>::kind>())) ^ 0xFFFFu;
+    if (mask)
+      return i + ctz(mask) / sizeof(T);
+  }
+  return i + mismatch_scalar(a + i, b + i, n - i);
+}
+
+// Signed 32-bit min/max from compare and select; unsigned inputs are
+// biased into signed range first.
+template <bool Max, bool Signed>
+FT_TARGET_SSE2 __m128i select32(__m128i a, __m128i b) {
+  __m128i bias = _mm_set1_epi32(Signed ? 0 : static_cast<int>(0x80000000u));
+  __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+  if (Max)
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+template <bool Max, typename T>
+FT_TARGET_SSE2 T extreme_sse2(const T* first, const T* last) {
+  const std::size_t step = 4;
+  __m128i acc = splat128(*first);
+  for (; static_cast<std::size_t>(last - first) >= step; first += step)
+    acc = select32<Max, minmax_lane<T>::is_signed>(
+      acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(first)));
+  T lanes[4];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  T best = lanes[0];
+  for (std::size_t i = 1; i < 4; ++i)
+    best = (Max ? best < lanes[i] : lanes[i] < best) ? lanes[i] : best;
+  for (; first != last; ++first)
+    best = (Max ? best < *first : *first < best) ? *first : best;
+  return best;
+}
+
+// AVX2
+
+FT_TARGET_AVX2 inline __m256i eq256(__m256i a, __m256i b, kind_tag<LANE_I8>) { return _mm256_cmpeq_epi8(a, b); }
+FT_TARGET_AVX2 inline __m256i eq256(__m256i a, __m256i b, kind_tag<LANE_I16>) { return _mm256_cmpeq_epi16(a, b); }
+FT_TARGET_AVX2 inline __m256i eq256(__m256i a, __m256i b, kind_tag<LANE_I32>) { return _mm256_cmpeq_epi32(a, b); }
+FT_TARGET_AVX2 inline __m256i eq256(__m256i a, __m256i b, kind_tag<LANE_I64>) { return _mm256_cmpeq_epi64(a, b); }
+FT_TARGET_AVX2 inline __m256i eq256(__m256i a, __m256i b, kind_tag<LANE_F32>) {
+  return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+}
+FT_TARGET_AVX2 inline __m256i eq256(__m256i a, __m256i b, kind_tag<LANE_F64>) {
+  return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+}
+
+template <typename T>
+FT_TARGET_AVX2 __m256i splat256(const T& value) {
+  T lanes[32 / sizeof(T)];
+  for (std::size_t i = 0; i < 32 / sizeof(T); ++i)
+    lanes[i] = value;
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes));
+}
+
+template <typename T>
+FT_TARGET_AVX2 const T* find_avx2(const T* first, const T* last, const T& value) {
+  const std::size_t step = 32 / sizeof(T);
+  __m256i v = splat256(value);
+  // Two vectors per iteration, one branch for both
+  for (; static_cast<std::size_t>(last - first) >= 2 * step; first += 2 * step) {
+    __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + step));
+    __m256i e0 = eq256(x0, v, kind_tag<lane<T>::kind>());
+    __m256i e1 = eq256(x1, v, kind_tag<lane<T>::kind>());
+    if (!_mm256_testz_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e0, e1))) {
+      unsigned m0 = _mm256_movemask_epi8(e0);
+      if (m0)
+        return first + ctz(m0) / sizeof(T);
+      return first + step + ctz(_mm256_movemask_epi8(e1)) / sizeof(T);
+    }
+  }
+  return find_scalar(first, last, value);
+}
+
+template <typename T>
+FT_TARGET_AVX2 std::size_t count_avx2(const T* first, const T* last, const T& value) {
+  const std::size_t step = 32 / sizeof(T);
+  __m256i v = splat256(value);
+  std::size_t bytes = 0;
+  while (static_cast<std::size_t>(last - first) >= step) {
+    std::size_t blocks = std::min<std::size_t>((last - first) / step, count_flush);
+    __m256i tally = _mm256_setzero_si256();
+    for (; blocks; --blocks, first += step) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+      tally = _mm256_sub_epi8(tally, eq256(x, v, kind_tag<lane<T>::kind>()));
+    }
+    __m256i sums = _mm256_sad_epu8(tally, _mm256_setzero_si256());
+    __m128i half = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+    bytes += _mm_cvtsi128_si32(half) + _mm_cvtsi128_si32(_mm_srli_si128(half, 8));
+  }
+  return bytes / sizeof(T) + count_scalar(first, last, value);
+}
+
+template <typename T>
+FT_TARGET_AVX2 std::size_t mismatch_avx2(const T* a, const T* b, std::size_t n) {
+  const std::size_t step = 32 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + step <= n; i += step) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+    unsigned mask = ~static_cast<unsigned>(_mm256_movemask_epi8(eq256(x, y, kind_tag<lane<T>::kind>())));
+    if (mask)
+      return i + ctz(mask) / sizeof(T);
+  }
+  return i + mismatch_scalar(a + i, b + i, n - i);
+}
+
+template <bool Max, bool Signed>
+FT_TARGET_AVX2 inline __m256i select32_avx2(__m256i a, __m256i b) {
+  if (Signed)
+    return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+  return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+}
+
+template <bool Max, typename T>
+FT_TARGET_AVX2 T extreme_avx2(const T* first, const T* last) {
+  const std::size_t step = 8;
+  __m256i acc = splat256(*first);
+  for (; static_cast<std::size_t>(last - first) >= step; first += step)
+    acc = select32_avx2<Max, minmax_lane<T>::is_signed>(
+      acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)));
+  T lanes[8];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+  T best = lanes[0];
+  for (std::size_t i = 1; i < 8; ++i)
+    best = (Max ? best < lanes[i] : lanes[i] < best) ? lanes[i] : best;
+  for (; first != last; ++first)
+    best = (Max ? best < *first : *first < best) ? *first : best;
+  return best;
+}
+
+// Pack-left for 32 and 64-bit lanes. Entry m lists, in order, the 32-bit
+// lanes whose bit is set in m; vpermd with it moves the kept lanes to the
+// front. A 64-bit lane owns two adjacent bits of the movemask_ps mask, so
+// the same table serves both widths.
+struct pack_left_table {
+  unsigned long long index[256];
+  unsigned char      count[256];
+
+  pack_left_table() {
+    for (unsigned m = 0; m < 256; ++m) {
+      unsigned long long entry = 0;
+      unsigned char n = 0;
+      for (unsigned lane_idx = 0; lane_idx < 8; ++lane_idx)
+        if (m & (1u << lane_idx))
+          entry |= static_cast<unsigned long long>(lane_idx) << (8 * n++);
+      index[m] = entry;
+      count[m] = n;
+    }
+  }
+};
+
+inline const pack_left_table& pack_left() {
+  static const pack_left_table table;
+  return table;
+}
+
+// Kept 32-bit lanes of x moved to the front; the rest of the vector is
+// unspecified. Returns the number of kept elements in *kept.
+template <typename T>
+FT_TARGET_AVX2 inline __m256i pack_left256(__m256i x, __m256i drop, std::size_t* kept) {
+  const pack_left_table& table = pack_left();
+  unsigned keep = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(drop))) & 0xFFu;
+  __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(table.index + keep)));
+  *kept = table.count[keep] * 4 / sizeof(T);
+  return _mm256_permutevar8x32_epi32(x, index);
+}
+
+// x moved up one element, with the last element of carry in front.
+// vpermd only reads the low three bits of each index.
+template <typename T>
+FT_TARGET_AVX2 inline __m256i shift_in256(__m256i x, __m256i carry) {
+  const int w = sizeof(T) / 4;
+  __m256i rotate = _mm256_setr_epi32(8 - w, 9 - w, 10 - w, 11 - w, 12 - w, 13 - w, 14 - w, 15 - w);
+  return _mm256_blend_epi32(_mm256_permutevar8x32_epi32(x, rotate),
+                            _mm256_permutevar8x32_epi32(carry, rotate), w == 1 ? 0x01 : 0x03);
+}
+
+// The store at out never reaches past the block just loaded, so compaction
+// in place is safe.
+template <typename T>
+FT_TARGET_AVX2 T* remove_avx2(T* first, T* last, const T& value) {
+  const std::size_t step = 32 / sizeof(T);
+  __m256i v = splat256(value);
+  T* out = first;
+  for (; static_cast<std::size_t>(last - first) >= step; first += step) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    std::size_t kept;
+    __m256i packed = pack_left256<T>(x, eq256(x, v, kind_tag<lane<T>::kind>()), &kept);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), packed);
+    out += kept;
+  }
+  return remove_if_scalar(out, first, last, equal_to_value<T>(value));
+}
+
+// Requires first != last. The previous block is carried in a register
+// because the store may already have overwritten its last element.
+template <typename T>
+FT_TARGET_AVX2 T* unique_avx2(T* first, T* last) {
+  const std::size_t step = 32 / sizeof(T);
+  __m256i carry = splat256(*first);
+  T* out = ++first;
+  for (; static_cast<std::size_t>(last - first) >= step; first += step) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    std::size_t kept;
+    __m256i drop = eq256(x, shift_in256<T>(x, carry), kind_tag<lane<T>::kind>());
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), pack_left256<T>(x, drop, &kept));
+    out += kept;
+    carry = x;
+  }
+  T lanes[32 / sizeof(T)];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), carry);
+  return unique_scalar(out, first, last, lanes[step - 1]);
+}
+
+#endif // FT_SIMD_X86
+
+// Dispatching entry points. They require lane<T>::kind != LANE_NONE
+// (minmax_lane<T>::supported for min/max).
+
+template <typename T>
+const T* find(const T* first, const T* last, const T& value) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2)
+    return find_avx2(first, last, value);
+  if (level >= SIMD_SSE2)
+    return find_sse2(first, last, value);
+#endif
+  return find_scalar(first, last, value);
+}
+
+template <typename T>
+std::size_t count(const T* first, const T* last, const T& value) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2)
+    return count_avx2(first, last, value);
+  if (level >= SIMD_SSE2)
+    return count_sse2(first, last, value);
+#endif
+  return count_scalar(first, last, value);
+}
+
+// Index of the first i < n with !(a[i] == b[i]), or n.
+template <typename T>
+std::size_t mismatch(const T* a, const T* b, std::size_t n) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2)
+    return mismatch_avx2(a, b, n);
+  if (level >= SIMD_SSE2)
+    return mismatch_sse2(a, b, n);
+#endif
+  return mismatch_scalar(a, b, n);
+}
+
+// Integers are equal exactly when their bytes are.
+template <typename T>
+bool equal(const T* a, const T* b, std::size_t n) {
+  if (lane<T>::is_integral)
+    return n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0;
+  return mismatch(a, b, n) == n;
+}
+
+// First position holding the minimum (Max: maximum) of a non-empty range:
+// one vector pass for the value, then a vector search for it.
+template <bool Max, typename T>
+const T* extreme_element(const T* first, const T* last) {
+#if FT_SIMD_X86
+  int level = simd_level();
+  if (level >= SIMD_AVX2)
+    return find_avx2(first, last, extreme_avx2<Max>(first, last));
+  if (level >= SIMD_SSE2)
+    return find_sse2(first, last, extreme_sse2<Max>(first, last));
+#endif
+  return Max ? max_scalar(first, last) : min_scalar(first, last);
+}
+
+// Pack-left needs 32 or 64-bit lanes.
+template <typename T>
+struct packs_left {
+  static const bool value = lane<T>::kind == LANE_I32 || lane<T>::kind == LANE_F32 ||
+                            lane<T>::kind == LANE_I64 || lane<T>::kind == LANE_F64;
+};
+
+// Compacts [first, last) in place, keeping the elements that are not equal
+// to value in order; returns the new end.
+template <typename T>
+T* remove(T* first, T* last, const T& value) {
+#if FT_SIMD_X86
+  if (packs_left<T>::value && simd_level() >= SIMD_AVX2)
+    return remove_avx2(first, last, value);
+#endif
+  return remove_if_scalar(first, first, last, equal_to_value<T>(value));
+}
+
+// Drops every element equal to the one before it; returns the new end.
+template <typename T>
+T* unique(T* first, T* last) {
+  if (first == last)
+    return last;
+#if FT_SIMD_X86
+  if (packs_left<T>::value && simd_level() >= SIMD_AVX2)
+    return unique_avx2(first, last);
+#endif
+  T prev = *first;
+  return unique_scalar(first + 1, first + 1, last, prev);
+}
+
+// Entry points for any element type: arithmetic types reach the kernels,
+// everything else runs the portable loops with the element's operators.
+template <typename T, bool Vectorized = (lane<T>::kind != LANE_NONE)>
+struct dispatch {
+  static const T* find(const T* first, const T* last, const T& value) {
+    return find_scalar(first, last, value);
+  }
+  static std::size_t count(const T* first, const T* last, const T& value) {
+    return count_scalar(first, last, value);
+  }
+  static std::size_t mismatch(const T* a, const T* b, std::size_t n) {
+    return mismatch_scalar(a, b, n);
+  }
+  static bool equal(const T* a, const T* b, std::size_t n) {
+    return mismatch_scalar(a, b, n) == n;
+  }
+  static bool less(const T* a, std::size_t na, const T* b, std::size_t nb) {
+    return std::lexicographical_compare(a, a + na, b, b + nb);
+  }
+  template <typename Predicate>
+  static T* remove_if(T* first, T* last, Predicate pred) {
+    return std::remove_if(first, last, pred);
+  }
+  static T* remove(T* first, T* last, const T& value) {
+    return std::remove(first, last, value);
+  }
+  static T* unique(T* first, T* last) {
+    return std::unique(first, last);
+  }
+};
+
+template <typename T>
+struct dispatch<T, true> {
+  static const T* find(const T* first, const T* last, const T& value) {
+    return _simd::find(first, last, value);
+  }
+  static std::size_t count(const T* first, const T* last, const T& value) {
+    return _simd::count(first, last, value);
+  }
+  static std::size_t mismatch(const T* a, const T* b, std::size_t n) {
+    return _simd::mismatch(a, b, n);
+  }
+  static bool equal(const T* a, const T* b, std::size_t n) {
+    return _simd::equal(a, b, n);
+  }
+  // Lexicographic order decided at the first unequal element. Only valid
+  // when == and < agree, so floating point (NaN) keeps the generic loop.
+  static bool less(const T* a, std::size_t na, const T* b, std::size_t nb) {
+    if (!lane<T>::is_integral)
+      return std::lexicographical_compare(a, a + na, b, b + nb);
+    std::size_t n = na < nb ? na : nb;
+    std::size_t i = _simd::mismatch(a, b, n);
+    return i == n ? na < nb : a[i] < b[i];
+  }
+  template <typename Predicate>
+  static T* remove_if(T* first, T* last, Predicate pred) {
+    return remove_if_scalar(first, first, last, pred);
+  }
+  static T* remove(T* first, T* last, const T& value) {
+    return _simd::remove(first, last, value);
+  }
+  static T* unique(T* first, T* last) {
+    return _simd::unique(first, last);
+  }
+};
+
+} // namespace _simd
+
+} // namespace ft
+
+#endif // FT_SIMD_HPP
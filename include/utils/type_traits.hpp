@@ -0,0 +1,39 @@
+#ifndef FT_TYPE_TRAITS_HPP
+#define FT_TYPE_TRAITS_HPP
+
+#include <limits>
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
+
+namespace ft {
+
+// Types that may be copied with memcpy and destroyed by doing nothing.
+// C++11 asks the compiler; C++98 can only vouch for arithmetic types and
+// pointers. Specialize for other POD types that should take the fast paths.
+template <typename T>
+struct is_trivially_copyable {
+#if __cplusplus >= 201103L
+  static const bool value = std::is_trivially_copyable<T>::value;
+#else
+  static const bool value = std::numeric_limits<T>::is_specialized;
+#endif
+};
+
+template <typename T>
+struct is_trivially_copyable<T*> {
+  static const bool value = true;
+};
+
+template <typename T>
+struct is_trivially_destructible {
+#if __cplusplus >= 201103L
+  static const bool value = std::is_trivially_destructible<T>::value;
+#else
+  static const bool value = is_trivially_copyable<T>::value;
+#endif
+};
+
+} // namespace ft
+
+#endif // FT_TYPE_TRAITS_HPP
@@ -0,0 +1,162 @@
+// Element loops over raw storage shared by the containers. Each one goes
+// through the allocator's construct and destroy, except that trivially
+// copyable ranges are copied with memcpy or memset and trivially
+// destructible ones are not destroyed at all. The shortcuts assume the
+// allocator's construct and destroy are plain placement new and destructor
+// calls, as for std::allocator and every allocator in this library.
+
+#ifndef FT_UNINITIALIZED_HPP
+#define FT_UNINITIALIZED_HPP
+
+#include <cstddef>
+#include <cstring>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+#include "utils/type_traits.hpp"
+#include "iterators/iterator_traits.hpp"
+#include "iterators/unwrap.hpp"
+
+namespace ft {
+
+namespace _uninitialized {
+
+template <bool B>
+struct tag {};
+
+template <typename InputIt, typename T, typename Alloc>
+T* copy(InputIt first, InputIt last, T* dest, Alloc& alloc, tag<false>) {
+  T* cur = dest;
+  try {
+    for (; first != last; ++first, ++cur)
+      alloc.construct(cur, *first);
+  } catch (...) {
+    for (; dest != cur; ++dest)
+      alloc.destroy(dest);
+    throw;
+  }
+  return cur;
+}
+
+template <typename T, typename Alloc>
+T* copy(const T* first, const T* last, T* dest, Alloc&, tag<true>) {
+  std::size_t n = last - first;
+  if (n)
+    std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+  return dest + n;
+}
+
+// Picks the memcpy path once the source is a pointer to the element type.
+template <typename InputIt, typename T, typename Alloc>
+T* copy(InputIt first, InputIt last, T* dest, Alloc& alloc) {
+  return copy(first, last, dest, alloc, tag<false>());
+}
+
+template <typename T, typename Alloc>
+T* copy(const T* first, const T* last, T* dest, Alloc& alloc) {
+  return copy(first, last, dest, alloc, tag<is_trivially_copyable<T>::value>());
+}
+
+template <typename T, typename Alloc>
+T* copy(T* first, T* last, T* dest, Alloc& alloc) {
+  return copy(static_cast<const T*>(first), static_cast<const T*>(last), dest, alloc);
+}
+
+template <typename T, typename Alloc>
+T* fill_n(T* dest, std::size_t n, const T& val, Alloc& alloc, tag<false>) {
+  std::size_t i = 0;
+  try {
+    for (; i < n; ++i)
+      alloc.construct(dest + i, val);
+  } catch (...) {
+    while (i)
+      alloc.destroy(dest + --i);
+    throw;
+  }
+  return dest + n;
+}
+
+// Bytes that are all equal (a char, or zero for anything) become one
+// memset; other values a plain store loop the compiler vectorizes.
+template <typename T, typename Alloc>
+T* fill_n(T* dest, std::size_t n, const T& val, Alloc&, tag<true>) {
+  if (!n)
+    return dest;
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&val);
+  std::size_t same = 1;
+  while (same < sizeof(T) && bytes[same] == bytes[0])
+    ++same;
+  if (same == sizeof(T) && (sizeof(T) == 1 || bytes[0] == 0)) {
+    std::memset(static_cast<void*>(dest), bytes[0], n * sizeof(T));
+  } else {
+    for (std::size_t i = 0; i < n; ++i)
+      dest[i] = val;
+  }
+  return dest + n;
+}
+
+template <typename ForwardIt, typename Alloc>
+void destroy(ForwardIt first, ForwardIt last, Alloc& alloc, tag<false>) {
+  for (; first != last; ++first)
+    alloc.destroy(&*first);
+}
+
+template <typename ForwardIt, typename Alloc>
+void destroy(ForwardIt, ForwardIt, Alloc&, tag<true>) {}
+
+} // namespace _uninitialized
+
+// Copy-constructs [first, last) into raw storage at dest and returns the
+// end of the new range. If a constructor throws, what was built is
+// destroyed and the exception propagates. ft::vector iterators are
+// unwrapped first, so their ranges take the memcpy path too.
+template <typename InputIt, typename T, typename Alloc>
+T* uninitialized_copy(InputIt first, InputIt last, T* dest, Alloc& alloc) {
+  return _uninitialized::copy(ft::unwrap(first), ft::unwrap(last), dest, alloc);
+}
+
+// Like uninitialized_copy, but under C++11 each element is passed to
+// alloc.construct as std::move_if_noexcept(*src): elements whose move
+// constructor may throw are copied, so a throw leaves the source intact
+// and callers keep the strong guarantee. Moved-from sources are valid but
+// unspecified; the caller still destroys them. An allocator with only
+// construct(p, const T&) copies every element. Before C++11 this is
+// uninitialized_copy.
+template <typename T, typename Alloc>
+T* uninitialized_move(T* first, T* last, T* dest, Alloc& alloc) {
+#if __cplusplus >= 201103L
+  if (is_trivially_copyable<T>::value)
+    return uninitialized_copy(first, last, dest, alloc);
+  T* cur = dest;
+  try {
+    for (; first != last; ++first, ++cur)
+      alloc.construct(cur, std::move_if_noexcept(*first));
+  } catch (...) {
+    for (; dest != cur; ++dest)
+      alloc.destroy(dest);
+    throw;
+  }
+  return cur;
+#else
+  return uninitialized_copy(first, last, dest, alloc);
+#endif
+}
+
+template <typename T, typename Alloc>
+T* uninitialized_fill_n(T* dest, std::size_t n, const T& val, Alloc& alloc) {
+  return _uninitialized::fill_n(dest, n, val, alloc,
+                                _uninitialized::tag<is_trivially_copyable<T>::value>());
+}
+
+// Runs the destructors of [first, last); nothing at all for trivially
+// destructible elements.
+template <typename ForwardIt, typename Alloc>
+void destroy(ForwardIt first, ForwardIt last, Alloc& alloc) {
+  typedef typename ft::iterator_traits<ForwardIt>::value_type value_type;
+  _uninitialized::destroy(first, last, alloc,
+                          _uninitialized::tag<is_trivially_destructible<value_type>::value>());
+}
+
+} // namespace ft
+
+#endif // FT_UNINITIALIZED_HPP
@@ -10,12 +10,19 @@
 #include "exception.hpp"
 #include "utils/swap.hpp"
 #include "utils/enable_if.hpp"
+#include "utils/simd.hpp"
+#include "utils/growth_policy.hpp"
+#include "utils/relocation.hpp"
+#include "utils/uninitialized.hpp"
+#include "iterators/iterator_traits.hpp"
 #include "iterators/random_access_iterator.hpp"
 #include "iterators/reverse_iterator.hpp"
 
 namespace ft {
 
-template <typename T, typename Alloc = std::allocator<T> >
+// Growth picks the capacity each reallocation grows to; see
+// utils/growth_policy.hpp.
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = ft::growth_doubling>
 class vector {
 public:
   typedef T                                       value_type;
@@ -26,6 +33,7 @@ public:
   typedef typename allocator_type::const_pointer  const_pointer;
   typedef std::size_t                             size_type;
   typedef std::ptrdiff_t                          difference_type;
+  typedef Growth                                  growth_policy;
 
   typedef ft::random_access_iterator<T>           iterator;
   typedef ft::random_access_iterator<const T>     const_iterator;
@@ -39,18 +47,107 @@ private:
   size_type      _capacity;
 
   void destroy_elements() {
-      for (size_type i = 0; i < _size; ++i)
-        _alloc.destroy(_data + i);
+    ft::destroy(_data, _data + _size, _alloc);
   }
 
-  void uninitialized_copy(pointer dest, const_pointer src, size_type count) {
-      for (size_type i = 0; i < count; ++i)
-        _alloc.construct(dest + i, src[i]);
+  // Moves the elements into a fresh block of n slots.
+  void reallocate(size_type n) {
+    pointer new_data = n ? _alloc.allocate(n) : pointer();
+    try {
+      ft::uninitialized_move(_data, _data + _size, new_data, _alloc);
+    } catch (...) {
+      if (new_data)
+        _alloc.deallocate(new_data, n);
+      throw;
+    }
+    destroy_elements();
+    if (_data)
+      _alloc.deallocate(_data, _capacity);
+    _data = new_data;
+    _capacity = n;
+  }
+
+  // Destroys the tail left behind by an in-place compaction.
+  size_type truncate(pointer new_end) {
+    size_type removed = (_data + _size) - new_end;
+    ft::destroy(new_end, _data + _size, _alloc);
+    _size -= removed;
+    return removed;
+  }
+
+  // Resizes the block through the allocator's reallocate (mremap for
+  // ft::mmap_allocator) when it has one and T is trivially relocatable.
+  bool relocate(size_type n) {
+    if (!_data) return false;
+    pointer moved = _relocate::resize(_alloc, _data, _capacity, n);
+    if (!moved) return false;
+    _data = moved;
+    _capacity = n;
+    return true;
   }
 
   void ensure_capacity(size_type min_capacity) {
     if (min_capacity > _capacity)
-        reserve(_capacity == 0 ? min_capacity : std::max(_capacity * 2, min_capacity));
+        reserve(Growth::next_capacity(_capacity, min_capacity, max_size(), sizeof(T)));
+  }
+
+  // Ranges that can be walked twice are counted first and copied into one
+  // allocation; input ranges can only be read once, so they grow as they go.
+  template <typename InputIterator>
+  void range_initialize(InputIterator first, InputIterator last, std::input_iterator_tag) {
+    try {
+      for (; first != last; ++first)
+        push_back(*first);
+    } catch (...) {
+      destroy_elements();
+      if (_data)
+        _alloc.deallocate(_data, _capacity);
+      throw;
+    }
+  }
+
+  template <typename ForwardIterator>
+  void range_initialize(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+    size_type n = ft::distance(first, last);
+    if (!n) return;
+    if (n > max_size())
+      throw std::length_error("vector: range exceeds max_size");
+    _data = _alloc.allocate(n);
+    _capacity = n;
+    try {
+      ft::uninitialized_copy(first, last, _data, _alloc);
+    } catch (...) {
+      _alloc.deallocate(_data, _capacity);
+      throw;
+    }
+    _size = n;
+  }
+
+  template <typename InputIterator>
+  void range_assign(InputIterator first, InputIterator last, std::input_iterator_tag) {
+    clear();
+    for (; first != last; ++first)
+      push_back(*first);
+  }
+
+  // Assigns over the live prefix, then constructs or destroys the rest.
+  template <typename ForwardIterator>
+  void range_assign(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+    size_type n = ft::distance(first, last);
+    if (n > _capacity) {
+      vector tmp(first, last, _alloc);
+      swap(tmp);
+      return;
+    }
+    pointer cur = _data;
+    for (; first != last && cur != _data + _size; ++first, ++cur)
+      *cur = *first;
+    if (first == last) {
+      truncate(cur);
+    } else {
+      ft::uninitialized_copy(first, last, _data + _size, _alloc);
+      _size = n;
+    }
   }
 
 public:
@@ -63,8 +160,12 @@ public:
     if (n > max_size())
       throw std::length_error("vector: n exceeds max_size");
     _data = _alloc.allocate(n);
-    for (size_type i = 0; i < n; ++i)
-      _alloc.construct(_data + i, val);
+    try {
+      ft::uninitialized_fill_n(_data, n, val, _alloc);
+    } catch (...) {
+      _alloc.deallocate(_data, _capacity);
+      throw;
+    }
   }
 
   template <typename InputIterator>
@@ -72,14 +173,21 @@ public:
        const allocator_type& alloc = allocator_type(),
        typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
     : _alloc(alloc), _data(NULL), _size(0), _capacity(0) {
-    for (; first != last; ++first)
-      push_back(*first);
+    range_initialize(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
   }
 
+  // Copies get exactly x.size() slots, not x's spare capacity.
   vector(const vector& x)
-    : _alloc(x._alloc), _data(NULL), _size(x._size), _capacity(x._capacity) {
+    : _alloc(x._alloc), _data(NULL), _size(x._size), _capacity(x._size) {
+    if (!_capacity)
+      return;
     _data = _alloc.allocate(_capacity);
-    uninitialized_copy(_data, x._data, _size);
+    try {
+      ft::uninitialized_copy(x._data, x._data + _size, _data, _alloc);
+    } catch (...) {
+      _alloc.deallocate(_data, _capacity);
+      throw;
+    }
   }
 
   ~vector() {
@@ -114,26 +222,25 @@ public:
 
   void resize(size_type n, value_type val = value_type()) {
     if (n < _size) {
-      for (size_type i = n; i < _size; ++i)
-        _alloc.destroy(_data + i);
+      ft::destroy(_data + n, _data + _size, _alloc);
     } else if (n > _size) {
       reserve(n);
-      for (size_type i = _size; i < n; ++i)
-        _alloc.construct(_data + i, val);
+      ft::uninitialized_fill_n(_data + _size, n - _size, val, _alloc);
     }
     _size = n;
   }
 
   void reserve(size_type n) {
     if (n <= _capacity) return;
-    pointer new_data = _alloc.allocate(n);
-    for (size_type i = 0; i < _size; ++i)
-      _alloc.construct(new_data + i, _data[i]);
-    destroy_elements();
-    if (_data)
-      _alloc.deallocate(_data, _capacity);
-    _data = new_data;
-    _capacity = n;
+    if (relocate(n)) return;
+    reallocate(n);
+  }
+
+  // Drops the spare capacity, reallocating to exactly size() slots.
+  void shrink_to_fit() {
+    if (_capacity == _size) return;
+    if (_size && relocate(_size)) return;
+    reallocate(_size);
   }
 
   // Element access
@@ -161,16 +268,15 @@ public:
   template <class InputIterator>
   void assign(InputIterator first, InputIterator last,
             typename enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
-    clear();
-    for (; first != last; ++first)
-      push_back(*first);
+    range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
   }
 
   void assign(size_type n, const value_type& val) {
+    value_type value(val);  // val may live in this vector
     clear();
     reserve(n);
-    for (_size = 0; _size < n; ++_size)
-      _alloc.construct(_data + _size, val);
+    ft::uninitialized_fill_n(_data, n, value, _alloc);
+    _size = n;
   }
 
   iterator insert(iterator position, const value_type& val) {
@@ -253,6 +359,22 @@ public:
     return iterator(_data + start);
   }
 
+  // One-pass compaction: kept elements move left in order and the tail is
+  // destroyed once. Each returns the number of elements removed.
+  template <typename Predicate>
+  size_type erase_if(Predicate pred) {
+    return truncate(_simd::dispatch<T>::remove_if(_data, _data + _size, pred));
+  }
+
+  size_type remove(const value_type& val) {
+    value_type value(val);  // val may live in this vector
+    return truncate(_simd::dispatch<T>::remove(_data, _data + _size, value));
+  }
+
+  // Keeps the first element of every run of equal elements.
+  size_type unique() {
+    return truncate(_simd::dispatch<T>::unique(_data, _data + _size));
+  }
 
   void push_back(const value_type& val) {
     ensure_capacity(_size + 1);
@@ -283,42 +405,40 @@ public:
 };
 
 // Non-member swap
-template <typename T, typename Alloc>
-void swap(vector<T, Alloc>& x, vector<T, Alloc>& y) {
+template <typename T, typename Alloc, typename Growth>
+void swap(vector<T, Alloc, Growth>& x, vector<T, Alloc, Growth>& y) {
   x.swap(y);
 }
 
 // Relational operators
-template <typename T, typename Alloc>
-bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename Growth>
+bool operator==(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
   if (lhs.size() != rhs.size()) return false;
-  for (std::size_t i = 0; i < lhs.size(); ++i)
-    if (!(lhs[i] == rhs[i])) return false;
-  return true;
+  return _simd::dispatch<T>::equal(lhs.begin().base(), rhs.begin().base(), lhs.size());
 }
 
-template <typename T, typename Alloc>
-bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename Growth>
+bool operator!=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
   return !(lhs == rhs);
 }
 
-template <typename T, typename Alloc>
-bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
-  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <typename T, typename Alloc, typename Growth>
+bool operator<(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
+  return _simd::dispatch<T>::less(lhs.begin().base(), lhs.size(), rhs.begin().base(), rhs.size());
 }
 
-template <typename T, typename Alloc>
-bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename Growth>
+bool operator<=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
   return !(rhs < lhs);
 }
 
-template <typename T, typename Alloc>
-bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename Growth>
+bool operator>(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
   return rhs < lhs;
 }
 
-template <typename T, typename Alloc>
-bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename Growth>
+bool operator>=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
   return !(lhs < rhs);
 }
 
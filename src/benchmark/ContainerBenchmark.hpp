@@ -30,12 +30,16 @@ class ContainerBenchmark {
   std::string type_name;
   std::string ns;
   std::vector<TestCase<Container, T>> test_cases;
+  bool wall_clock;
 
 public:
   ContainerBenchmark(const std::string& ns_label,
                      const std::string& type,
                      const std::string& container)
-    : container_name(container), type_name(type), ns(ns_label) {}
+    : container_name(container), type_name(type), ns(ns_label), wall_clock(false) {}
+
+  // Time cases on the wall clock; needed when a case spawns threads.
+  void use_wall_clock() { wall_clock = true; }
 
   void add(const std::string& label, void (*func)(Container&, const std::vector<T>&)) {
     test_cases.push_back(TestCase<Container, T>(label, func));
@@ -51,10 +55,12 @@ public:
             << " / " << test_cases[i].label << " [" << container_name << "]";
       print_progress(i, total, label.str());
 
-      double time = benchmark::measure_time([&]() {
+      auto body = [&]() {
         Container c;
         test_cases[i].func(c, data);
-      });
+      };
+      double time = wall_clock ? benchmark::measure_wall_time(body)
+                               : benchmark::measure_time(body);
 
       out << type_name << "," << test_cases[i].label << "," << count << "," << ns << "," << time << "\n";
       std::cout << "\r" << std::string(80, ' ') << "\r";
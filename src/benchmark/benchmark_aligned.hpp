@@ -0,0 +1,103 @@
+#include <sstream>
+#include <vector>
+#include <thread>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+#include "memory/aligned_allocator.hpp"
+
+namespace benchmark {
+
+// The same kernels over the same 64-byte aligned buffer, once from its
+// first element and once from one element in, so every 32-byte load of
+// the second pass straddles a cache line every other time.
+template <typename T>
+void run_aligned_scan_cases(const char* type, std::size_t count, std::ofstream& out) {
+  static const char* functions[] = { "find", "count", "sum" };
+  static const char* namespaces[] = { "ft_aligned", "ft_unaligned" };
+  std::size_t reps = (std::size_t(1) << 24) / (count ? count : 1);
+  if (!reps)
+    reps = 1;
+
+  std::vector<T> data = generate_data<T>(count);
+  T missing = *std::max_element(data.begin(), data.end()) + 1;
+  ft::vector<T, ft::aligned_allocator<T> > buffer(count + 1);
+  long long sink = 0;
+  std::size_t done = 0;
+
+  for (int f = 0; f < 3; ++f) {
+    for (int offset = 0; offset < 2; ++offset) {
+      print_progress(done++, 6, std::string(namespaces[offset]) + " / " + type + " / " +
+                                    functions[f] + " [aligned]");
+      T* first = &buffer[0] + offset;
+      T* last = first + count;
+      std::copy(data.begin(), data.end(), first);
+      double time = measure_time([&]() {
+        for (std::size_t r = 0; r < reps; ++r) {
+          switch (f) {
+            case 0: sink += ft::find(first, last, missing) - first; break;
+            case 1: sink += ft::count(first, last, data[r % count]); break;
+            case 2: {
+              T sum = T();
+              for (T* p = first; p != last; ++p)
+                sum += *p;
+              sink += static_cast<long long>(sum);
+              break;
+            }
+          }
+        }
+      });
+      out << type << "," << functions[f] << "," << count << "," << namespaces[offset] << ","
+          << time << "\n";
+    }
+  }
+  if (sink == -1)
+    std::cerr << "\naligned benchmark: unexpected checksum" << std::endl;
+}
+
+inline long& counter_of(long& slot) { return slot; }
+inline long& counter_of(ft::cache_padded<long>& slot) { return slot.value; }
+
+// Each thread bumps its own counter; packed counters share cache lines,
+// padded ones do not.
+template <typename Vec>
+double run_counter_threads(std::size_t threads, std::size_t iterations) {
+  Vec slots(threads);
+  return measure_wall_time([&]() {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t)
+      workers.push_back(std::thread([&slots, t, iterations]() {
+        volatile long& counter = counter_of(slots[t]);
+        for (std::size_t i = 0; i < iterations; ++i)
+          counter = counter + 1;
+      }));
+    for (std::size_t t = 0; t < workers.size(); ++t)
+      workers[t].join();
+  });
+}
+
+inline void run_false_sharing_cases(std::size_t count, std::ofstream& out) {
+  typedef ft::cache_padded<long> slot;
+  std::size_t threads = std::thread::hardware_concurrency();
+  if (threads < 2)
+    threads = 2;
+  if (threads > 8)
+    threads = 8;
+  std::size_t iterations = count * 100;
+
+  print_progress(0, 2, "ft_packed / long / counters [aligned]");
+  out << "long,counters," << count << ",ft_packed,"
+      << run_counter_threads<ft::vector<long> >(threads, iterations) << "\n";
+  print_progress(1, 2, "ft_padded / long / counters [aligned]");
+  out << "long,counters," << count << ",ft_padded,"
+      << run_counter_threads<ft::vector<slot, ft::aligned_allocator<slot> > >(threads, iterations)
+      << "\n";
+}
+
+inline void run_aligned_benchmark(std::size_t count, std::ofstream& out) {
+  run_aligned_scan_cases<int>("int", count, out);
+  run_false_sharing_cases(count, out);
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
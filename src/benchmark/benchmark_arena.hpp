@@ -0,0 +1,71 @@
+#include <sstream>
+#include <vector>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+#include "deque.hpp"
+#include "memory/monotonic_arena.hpp"
+
+namespace benchmark {
+
+// One simulated request: a vector, a list and a deque of length elements,
+// built, read and dropped.
+template <typename Alloc, typename T>
+std::size_t handle_request(const std::vector<T>& data, std::size_t offset, std::size_t length,
+                           const Alloc& alloc) {
+  typedef typename Alloc::template rebind<T>::other alloc_type;
+  ft::vector<T, alloc_type> v(alloc);
+  ft::list<T, alloc_type> l(alloc);
+  for (std::size_t j = 0; j < length; ++j) {
+    v.push_back(data[(offset + j) % data.size()]);
+    l.push_back(data[(offset + j) % data.size()]);
+  }
+  ft::deque<T, alloc_type> d(length, data[offset % data.size()], alloc);
+  return v.size() + l.size() + d.size();
+}
+
+template <typename T>
+void run_arena_cases(const char* type, std::size_t count, std::ofstream& out) {
+  static const std::size_t lengths[] = { 16, 128 };
+  static const char* names[] = { "ft_arena", "ft_arena_heap", "ft" };
+  std::vector<T> data = generate_data<T>(256);
+  std::size_t done = 0;
+
+  for (int l = 0; l < 2; ++l) {
+    std::ostringstream fn;
+    fn << "request_" << lengths[l];
+    for (int variant = 0; variant < 3; ++variant) {
+      print_progress(done++, 6, std::string(names[variant]) + " / " + type + " / " + fn.str() +
+                                    " [arena]");
+      std::size_t touched = 0;
+      double time = measure_time([&]() {
+        if (variant == 2) {
+          for (std::size_t i = 0; i < count; ++i)
+            touched += handle_request(data, i, lengths[l], std::allocator<T>());
+          return;
+        }
+        // ft_arena starts from a stack buffer, ft_arena_heap from heap chunks
+        char buffer[64 * 1024];
+        ft::monotonic_arena stack_arena(buffer, sizeof(buffer));
+        ft::monotonic_arena heap_arena(sizeof(buffer));
+        ft::monotonic_arena& arena = variant == 0 ? stack_arena : heap_arena;
+        for (std::size_t i = 0; i < count; ++i) {
+          touched += handle_request(data, i, lengths[l], ft::arena_allocator<T>(&arena));
+          arena.release();
+        }
+      });
+      if (touched != count * lengths[l] * 3)
+        std::cerr << "\narena benchmark: wrong element count" << std::endl;
+      out << type << "," << fn.str() << "," << count << "," << names[variant] << "," << time
+          << "\n";
+    }
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+inline void run_arena_benchmark(std::size_t count, std::ofstream& out) {
+  run_arena_cases<int>("int", count, out);
+  run_arena_cases<std::string>("string", count, out);
+}
+
+} // namespace benchmark
@@ -0,0 +1,114 @@
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+#include "dynamic_bitset.hpp"
+
+namespace benchmark {
+
+// Flag arrays of count bits four ways: ft::dynamic_bitset with its SIMD
+// kernels and capped to scalar ones, std::vector<bool>, and ft::vector<bool>
+// at a byte per flag. Bytes is the storage each one holds.
+inline void run_bitset_benchmark(std::size_t count, std::ofstream& out) {
+  static const char* functions[] = { "build", "count", "find_next", "and" };
+  static const char* namespaces[] = { "ft_bitset", "ft_bitset_scalar", "std_vector_bool", "ft_vector_bool" };
+  std::size_t reps = (std::size_t(1) << 26) / (count ? count : 1);
+  if (!reps)
+    reps = 1;
+
+  // One flag in 61 set, plus a denser mask for AND
+  std::vector<bool> flags(count);
+  std::vector<bool> mask(count);
+  for (std::size_t i = 0; i < count; i += 61)
+    flags[i] = true;
+  for (std::size_t i = 0; i < count; ++i)
+    mask[i] = (i % 3) != 0;
+
+  ft::dynamic_bitset<> bits;
+  ft::dynamic_bitset<> bits_mask;
+  std::vector<bool> std_bits;
+  ft::vector<bool> ft_bytes;
+  std::size_t bytes[4] = { 0, 0, 0, 0 };
+  long long sink = 0;
+  std::size_t done = 0;
+
+  for (int f = 0; f < 4; ++f) {
+    for (int ns = 0; ns < 4; ++ns) {
+      print_progress(done++, 16, std::string(namespaces[ns]) + " / bool / " + functions[f] + " [bitset]");
+      ft::set_simd_level(ns == 1 ? ft::SIMD_SCALAR : ft::SIMD_AVX2);
+      double time = measure_time([&]() {
+        std::size_t r = f == 0 ? 1 : reps;
+        for (; r; --r) {
+          if (f == 0) {
+            // build: the flags pushed one at a time
+            if (ns <= 1) {
+              ft::dynamic_bitset<> b;
+              for (std::size_t i = 0; i < count; ++i)
+                b.push_back(flags[i]);
+              bytes[ns] = b.num_blocks() * sizeof(ft::dynamic_bitset<>::block_type);
+              bits.swap(b);
+            } else if (ns == 2) {
+              std::vector<bool> b;
+              for (std::size_t i = 0; i < count; ++i)
+                b.push_back(flags[i]);
+              bytes[ns] = (b.capacity() + 7) / 8;
+              std_bits.swap(b);
+            } else {
+              ft::vector<bool> b;
+              for (std::size_t i = 0; i < count; ++i)
+                b.push_back(flags[i]);
+              bytes[ns] = b.capacity() * sizeof(bool);
+              ft_bytes.swap(b);
+            }
+          } else if (f == 1) {
+            switch (ns) {
+              case 0: case 1: sink += bits.count(); break;
+              case 2: sink += std::count(std_bits.begin(), std_bits.end(), true); break;
+              case 3: sink += ft::count(ft_bytes.begin(), ft_bytes.end(), true); break;
+            }
+          } else if (f == 2) {
+            // find_next: visit every set flag
+            if (ns <= 1) {
+              for (std::size_t i = bits.find_first(); i != bits.npos; i = bits.find_next(i))
+                sink += i;
+            } else if (ns == 2) {
+              std::vector<bool>::iterator it = std::find(std_bits.begin(), std_bits.end(), true);
+              for (; it != std_bits.end(); it = std::find(it + 1, std_bits.end(), true))
+                sink += it - std_bits.begin();
+            } else {
+              ft::vector<bool>::iterator it = ft::find(ft_bytes.begin(), ft_bytes.end(), true);
+              for (; it != ft_bytes.end(); it = ft::find(it + 1, ft_bytes.end(), true))
+                sink += it - ft_bytes.begin();
+            }
+          } else {
+            // and: the flags masked in place; the pattern is periodic, so
+            // repeating it does not change the result
+            if (ns <= 1) {
+              bits &= bits_mask;
+            } else if (ns == 2) {
+              for (std::size_t i = 0; i < count; ++i)
+                std_bits[i] = std_bits[i] && mask[i];
+            } else {
+              for (std::size_t i = 0; i < count; ++i)
+                ft_bytes[i] = ft_bytes[i] && mask[i];
+            }
+          }
+        }
+      });
+      if (f == 0 && ns == 1)
+        for (std::size_t i = 0; i < count; ++i)
+          bits_mask.push_back(mask[i]);
+      out << "bool," << functions[f] << "," << count << "," << namespaces[ns] << "," << time << ","
+          << bytes[ns] << "\n";
+    }
+  }
+  ft::set_simd_level(ft::SIMD_AVX2);
+  if (sink == -1)
+    std::cerr << "\nbitset benchmark: unexpected checksum" << std::endl;
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
@@ -0,0 +1,78 @@
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+
+namespace benchmark {
+
+template <typename T>
+std::vector<T> contiguous_data(std::size_t count) {
+  std::vector<int> ints = generate_data<int>(count);
+  return std::vector<T>(ints.begin(), ints.end());
+}
+
+// The same copy and comparison three ways: the standard algorithm on
+// ft::vector iterators, which it only sees as class types; ft::copy and
+// ft::lexicographical_compare, which unwrap them to pointers; and the
+// standard algorithm on std::vector, the memmove/memcmp baseline.
+template <typename T>
+void run_contiguous_cases(const char* type, std::size_t count, std::ofstream& out) {
+  static const char* functions[] = { "copy", "lexicographical_compare" };
+  static const char* namespaces[] = { "std_on_ft", "ft", "std" };
+  std::size_t reps = (std::size_t(1) << 24) / (count ? count : 1);
+  if (!reps)
+    reps = 1;
+
+  std::vector<T> data = contiguous_data<T>(count);
+  ft::vector<T> ft_src(data.begin(), data.end());
+  ft::vector<T> ft_dst(count);
+  std::vector<T> std_src(data);
+  std::vector<T> std_dst(count);
+  long long sink = 0;
+  std::size_t done = 0;
+
+  for (int f = 0; f < 2; ++f) {
+    for (int ns = 0; ns < 3; ++ns) {
+      print_progress(done++, 6, std::string(namespaces[ns]) + " / " + type + " / " +
+                                    functions[f] + " [contiguous]");
+      // Equal ranges, so the comparison reads both to the end
+      ft::copy(ft_src.begin(), ft_src.end(), ft_dst.begin());
+      std::copy(std_src.begin(), std_src.end(), std_dst.begin());
+      double time = measure_time([&]() {
+        for (std::size_t r = 0; r < reps; ++r) {
+          if (f == 0) {
+            switch (ns) {
+              case 0: std::copy(ft_src.begin(), ft_src.end(), ft_dst.begin()); break;
+              case 1: ft::copy(ft_src.begin(), ft_src.end(), ft_dst.begin()); break;
+              case 2: std::copy(std_src.begin(), std_src.end(), std_dst.begin()); break;
+            }
+            sink += count ? static_cast<long long>(ns == 2 ? std_dst[r % count] : ft_dst[r % count]) : 0;
+          } else {
+            switch (ns) {
+              case 0: sink += std::lexicographical_compare(ft_src.begin(), ft_src.end(),
+                                                           ft_dst.begin(), ft_dst.end()); break;
+              case 1: sink += ft::lexicographical_compare(ft_src.begin(), ft_src.end(),
+                                                          ft_dst.begin(), ft_dst.end()); break;
+              case 2: sink += std::lexicographical_compare(std_src.begin(), std_src.end(),
+                                                           std_dst.begin(), std_dst.end()); break;
+            }
+          }
+        }
+      });
+      out << type << "," << functions[f] << "," << count << "," << namespaces[ns] << ","
+          << time << "\n";
+    }
+  }
+  if (sink == -1)
+    std::cerr << "\ncontiguous benchmark: unexpected checksum" << std::endl;
+}
+
+inline void run_contiguous_benchmark(std::size_t count, std::ofstream& out) {
+  run_contiguous_cases<int>("int", count, out);
+  run_contiguous_cases<unsigned char>("uchar", count, out);
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+
+namespace benchmark {
+
+// A predicate that drops about percent% of generate_data's output: ints are
+// uniform over [0, RAND_MAX], Point::x over [0, 1000).
+struct DropBelow {
+  int percent;
+  explicit DropBelow(int p) : percent(p) {}
+  bool operator()(int x) const { return x < static_cast<int>(RAND_MAX / 100.0 * percent); }
+  bool operator()(const Point& p) const { return p.x < percent * 10; }
+};
+
+// Element that remove(value) drops: generated data with percent% of the
+// slots overwritten by it.
+template <typename T>
+std::vector<T> filter_input(std::size_t count, int percent, T* marker) {
+  std::vector<T> data = generate_data<T>(count);
+  *marker = data[0];
+  for (std::size_t i = 0; i < count; ++i)
+    if (rand() % 100 < percent)
+      data[i] = *marker;
+  return data;
+}
+
+// Runs of four equal elements on average, so unique keeps about a quarter
+template <typename T>
+std::vector<T> unique_input(std::size_t count) {
+  std::vector<T> data = generate_data<T>(count);
+  for (std::size_t i = 1; i < count; ++i)
+    if (rand() % 4)
+      data[i] = data[i - 1];
+  return data;
+}
+
+// ft erase_if / remove / unique against the erase-remove idiom on std::vector.
+// ft_scalar rows cap the SIMD level to time the branchless loops alone.
+template <typename T>
+void run_filter_cases(const char* type, std::size_t count, std::ofstream& out) {
+  static const int percents[] = { 1, 10, 50, 90, 99 };
+  std::size_t total = 5 * 5 + 3;
+  std::size_t done = 0;
+
+  for (int p = 0; p < 5; ++p) {
+    std::ostringstream pct;
+    pct << percents[p];
+    DropBelow pred(percents[p]);
+    std::vector<T> data = generate_data<T>(count);
+
+    print_progress(done++, total, std::string("ft / ") + type + " / erase_if_" + pct.str() + " [filter]");
+    ft::vector<T> ft_vec(data.begin(), data.end());
+    double ft_time = measure_time([&]() { ft_vec.erase_if(pred); });
+
+    print_progress(done++, total, std::string("std / ") + type + " / erase_if_" + pct.str() + " [filter]");
+    std::vector<T> std_vec(data);
+    double std_time = measure_time([&]() {
+      std_vec.erase(std::remove_if(std_vec.begin(), std_vec.end(), pred), std_vec.end());
+    });
+    if (ft_vec.size() != std_vec.size())
+      std::cerr << "\nfilter benchmark: erase_if sizes differ" << std::endl;
+    out << type << ",erase_if_" << pct.str() << "," << count << ",ft," << ft_time << "\n";
+    out << type << ",erase_if_" << pct.str() << "," << count << ",std," << std_time << "\n";
+
+    T marker;
+    std::vector<T> marked = filter_input<T>(count, percents[p], &marker);
+    static const char* remove_names[] = { "ft_scalar", "ft", "std" };
+    for (int variant = 0; variant < 3; ++variant) {
+      print_progress(done++, total, std::string(remove_names[variant]) + " / " + type + " / remove_" +
+                                        pct.str() + " [filter]");
+      ft::set_simd_level(variant == 0 ? ft::SIMD_SCALAR : ft::SIMD_AVX2);
+      ft::vector<T> ft_marked(marked.begin(), marked.end());
+      std::vector<T> std_marked(marked);
+      double time = measure_time([&]() {
+        if (variant < 2)
+          ft_marked.remove(marker);
+        else
+          std_marked.erase(std::remove(std_marked.begin(), std_marked.end(), marker), std_marked.end());
+      });
+      out << type << ",remove_" << pct.str() << "," << count << "," << remove_names[variant] << ","
+          << time << "\n";
+    }
+  }
+
+  std::vector<T> runs = unique_input<T>(count);
+  static const char* unique_names[] = { "ft_scalar", "ft", "std" };
+  for (int variant = 0; variant < 3; ++variant) {
+    print_progress(done++, total, std::string(unique_names[variant]) + " / " + type + " / unique [filter]");
+    ft::set_simd_level(variant == 0 ? ft::SIMD_SCALAR : ft::SIMD_AVX2);
+    ft::vector<T> ft_runs(runs.begin(), runs.end());
+    std::vector<T> std_runs(runs);
+    double time = measure_time([&]() {
+      if (variant < 2)
+        ft_runs.unique();
+      else
+        std_runs.erase(std::unique(std_runs.begin(), std_runs.end()), std_runs.end());
+    });
+    out << type << ",unique," << count << "," << unique_names[variant] << "," << time << "\n";
+  }
+  ft::set_simd_level(ft::SIMD_AVX2);
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+inline void run_filter_benchmark(std::size_t count, std::ofstream& out) {
+  run_filter_cases<int>("int", count, out);
+  run_filter_cases<Point>("point", count, out);
+}
+
+} // namespace benchmark
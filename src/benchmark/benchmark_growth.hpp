@@ -0,0 +1,61 @@
+#include <sstream>
+#include <vector>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "utils/growth_policy.hpp"
+
+namespace benchmark {
+
+// Spare capacity over a whole fill, as a fraction of the elements held:
+// sum(capacity) / sum(size) - 1 sampled after every push_back.
+template <typename Vec>
+double mean_overhead(std::size_t count) {
+  Vec v;
+  double held = 0;
+  double reserved = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    v.push_back(typename Vec::value_type());
+    held += v.size();
+    reserved += v.capacity();
+  }
+  return held ? reserved / held - 1 : 0;
+}
+
+template <typename Vec, typename T>
+void run_growth_case(const char* type, const char* name, const std::vector<T>& data,
+                     std::ofstream& out) {
+  Vec v;
+  allocation_count() = 0;
+  double time = measure_time([&]() {
+    for (std::size_t i = 0; i < data.size(); ++i)
+      v.push_back(data[i]);
+  });
+  std::size_t allocations = allocation_count();
+  out << type << ",push_back," << data.size() << "," << name << "," << time << ","
+      << mean_overhead<Vec>(data.size()) << "," << allocations << "\n";
+}
+
+// push_back throughput against memory overhead for each growth policy.
+template <typename T>
+void run_growth_cases(const char* type, std::size_t count, std::ofstream& out) {
+  typedef CountingAllocator<T> alloc;
+  std::vector<T> data = generate_data<T>(count);
+
+  print_progress(0, 4, std::string("ft_2x / ") + type + " / push_back [growth]");
+  run_growth_case<ft::vector<T, alloc, ft::growth_doubling> >(type, "ft_2x", data, out);
+  print_progress(1, 4, std::string("ft_1.5x / ") + type + " / push_back [growth]");
+  run_growth_case<ft::vector<T, alloc, ft::growth_one_and_half> >(type, "ft_1.5x", data, out);
+  print_progress(2, 4, std::string("ft_size_class / ") + type + " / push_back [growth]");
+  run_growth_case<ft::vector<T, alloc, ft::growth_size_class> >(type, "ft_size_class", data, out);
+  print_progress(3, 4, std::string("std / ") + type + " / push_back [growth]");
+  run_growth_case<std::vector<T, alloc> >(type, "std", data, out);
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+inline void run_growth_benchmark(std::size_t count, std::ofstream& out) {
+  run_growth_cases<int>("int", count, out);
+  run_growth_cases<std::string>("string", count, out);
+  run_growth_cases<Point>("point", count, out);
+}
+
+} // namespace benchmark
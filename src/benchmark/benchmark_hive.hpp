@@ -0,0 +1,131 @@
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+#include "hive.hpp"
+#include "Point.hpp"
+
+namespace benchmark {
+
+// How each container inserts and erases one element: hive and list keep
+// an iterator per element, vector can only erase by position and shifts
+// everything after it.
+template <typename Seq>
+struct hive_ops {
+  typedef typename Seq::iterator handle;
+
+  static handle insert(Seq& seq, const Point& p) {
+    seq.push_back(p);
+    return --seq.end();
+  }
+
+  static void erase(Seq& seq, std::vector<handle>& handles, std::size_t k) { seq.erase(handles[k]); }
+};
+
+template <>
+struct hive_ops<ft::hive<Point> > {
+  typedef ft::hive<Point>::iterator handle;
+
+  static handle insert(ft::hive<Point>& seq, const Point& p) { return seq.insert(p); }
+
+  static void erase(ft::hive<Point>& seq, std::vector<handle>& handles, std::size_t k) {
+    seq.erase(handles[k]);
+  }
+};
+
+template <>
+struct hive_ops<ft::vector<Point> > {
+  typedef std::size_t handle;
+
+  static handle insert(ft::vector<Point>& seq, const Point& p) {
+    seq.push_back(p);
+    return 0;
+  }
+
+  static void erase(ft::vector<Point>& seq, std::vector<handle>&, std::size_t k) {
+    seq.erase(seq.begin() + k % seq.size());
+  }
+};
+
+template <typename Seq>
+long long sum_x(const Seq& seq) {
+  long long sum = 0;
+  for (typename Seq::const_iterator it = seq.begin(); it != seq.end(); ++it)
+    sum += it->x;
+  return sum;
+}
+
+// insert: count inserts into an empty container. erase_insert: count / 8
+// random erases, each followed by an insert. iterate: a full pass once a
+// quarter of the elements have been replaced that way.
+template <typename Seq>
+void run_hive_cases(const char* ns, const std::vector<Point>& data, std::size_t reps,
+                    std::ofstream& out, std::size_t& done) {
+  typedef hive_ops<Seq> ops;
+  static const char* functions[] = { "insert", "erase_insert", "iterate" };
+  std::size_t count = data.size();
+  std::vector<std::size_t> victims(count / 4);
+  for (std::size_t i = 0; i < victims.size(); ++i)
+    victims[i] = static_cast<std::size_t>(std::rand()) % count;
+  long long sink = 0;
+
+  for (int f = 0; f < 3; ++f) {
+    print_progress(done++, 9, std::string(ns) + " / point / " + functions[f] + " [hive]");
+    double time = 0;
+    std::size_t runs = f == 2 ? 1 : reps;
+    for (std::size_t r = 0; r < runs; ++r) {
+      Seq seq;
+      std::vector<typename ops::handle> handles(count);
+      if (f == 0) {
+        time += measure_time([&]() {
+          for (std::size_t i = 0; i < count; ++i)
+            handles[i] = ops::insert(seq, data[i]);
+        });
+        sink += seq.size();
+        continue;
+      }
+      for (std::size_t i = 0; i < count; ++i)
+        handles[i] = ops::insert(seq, data[i]);
+      if (f == 1) {
+        time += measure_time([&]() {
+          for (std::size_t i = 0; i < victims.size() / 2; ++i) {
+            ops::erase(seq, handles, victims[i]);
+            handles[victims[i]] = ops::insert(seq, data[i]);
+          }
+        });
+        sink += seq.size();
+        continue;
+      }
+      for (std::size_t i = 0; i < victims.size(); ++i) {
+        ops::erase(seq, handles, victims[i]);
+        handles[victims[i]] = ops::insert(seq, data[i]);
+      }
+      time = measure_time([&]() {
+        for (std::size_t k = 0; k < reps * 8; ++k)
+          sink += sum_x(seq);
+      });
+    }
+    out << "point," << functions[f] << "," << count << "," << ns << "," << time << "\n";
+  }
+  if (sink == -1)
+    std::cerr << "\nhive benchmark: unexpected checksum" << std::endl;
+}
+
+// Points in a hive, a list and a vector under a mix of inserts, erases
+// of random elements and full iteration.
+inline void run_hive_benchmark(std::size_t count, std::ofstream& out) {
+  std::size_t reps = (std::size_t(1) << 20) / (count ? count : 1);
+  if (!reps)
+    reps = 1;
+  std::vector<Point> data = generate_data<Point>(count);
+  std::size_t done = 0;
+
+  run_hive_cases<ft::vector<Point> >("ft_vector", data, reps, out, done);
+  run_hive_cases<ft::list<Point> >("ft_list", data, reps, out, done);
+  run_hive_cases<ft::hive<Point> >("ft_hive", data, reps, out, done);
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
@@ -0,0 +1,109 @@
+#include <queue>
+#include "ContainerBenchmark.hpp"
+#include "indexed_heap.hpp"
+
+namespace benchmark {
+
+// The workaround ft::indexed_heap replaces: a std::priority_queue where an
+// update pushes a fresh entry and stale entries are skipped when they
+// surface at the top.
+template <typename T>
+class LazyHeap {
+  struct Entry {
+    T value;
+    std::size_t handle;
+    unsigned version;
+
+    Entry(const T& v, std::size_t h, unsigned ver) : value(v), handle(h), version(ver) {}
+    bool operator<(const Entry& other) const { return value < other.value; }
+  };
+
+  std::priority_queue<Entry> _queue;
+  std::vector<unsigned> _version;
+  std::vector<bool> _alive;
+  std::size_t _size;
+
+  void prune() {
+    while (!_queue.empty()) {
+      const Entry& e = _queue.top();
+      if (_alive[e.handle] && _version[e.handle] == e.version)
+        break;
+      _queue.pop();
+    }
+  }
+
+public:
+  typedef std::size_t handle_type;
+
+  LazyHeap() : _size(0) {}
+
+  bool empty() const { return _size == 0; }
+  std::size_t size() const { return _size; }
+  const T& top() const { return _queue.top().value; }
+
+  handle_type push(const T& val) {
+    handle_type h = _version.size();
+    _version.push_back(0);
+    _alive.push_back(true);
+    _queue.push(Entry(val, h, 0));
+    ++_size;
+    return h;
+  }
+
+  void update(handle_type h, const T& val) {
+    _queue.push(Entry(val, h, ++_version[h]));
+    prune();
+  }
+
+  void erase(handle_type h) {
+    _alive[h] = false;
+    --_size;
+    prune();
+  }
+
+  void pop() {
+    _alive[_queue.top().handle] = false;
+    _queue.pop();
+    --_size;
+    prune();
+  }
+};
+
+} // namespace benchmark
+
+template <typename Heap, typename T>
+void register_indexed_heap_tests(benchmark::ContainerBenchmark<Heap, T>& bench) {
+  bench.add("push", [](Heap& h, const std::vector<T>& data) {
+    for (std::size_t i = 0; i < data.size(); ++i)
+      h.push(data[i]);
+  });
+
+  bench.add("push_pop", [](Heap& h, const std::vector<T>& data) {
+    for (std::size_t i = 0; i < data.size(); ++i)
+      h.push(data[i]);
+    while (!h.empty())
+      h.pop();
+  });
+
+  // Dijkstra-like: every queued item gets re-prioritised once before draining
+  bench.add("update_pop", [](Heap& h, const std::vector<T>& data) {
+    std::vector<typename Heap::handle_type> handles;
+    for (std::size_t i = 0; i < data.size(); ++i)
+      handles.push_back(h.push(data[i]));
+    for (std::size_t i = 0; i < handles.size(); ++i)
+      h.update(handles[i], data[(i * 7) % data.size()]);
+    while (!h.empty())
+      h.pop();
+  });
+
+  // Timer cancellation: half of the queued items are removed before draining
+  bench.add("erase_pop", [](Heap& h, const std::vector<T>& data) {
+    std::vector<typename Heap::handle_type> handles;
+    for (std::size_t i = 0; i < data.size(); ++i)
+      handles.push_back(h.push(data[i]));
+    for (std::size_t i = 0; i < handles.size(); i += 2)
+      h.erase(handles[i]);
+    while (!h.empty())
+      h.pop();
+  });
+}
@@ -0,0 +1,118 @@
+#include <sstream>
+#include <vector>
+#include <cstring>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "memory/mmap_allocator.hpp"
+#if defined(__linux__)
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace benchmark {
+
+// Counts data-TLB read misses of the calling thread between start() and
+// stop(). stop() returns -1 when perf events are unavailable (non-Linux,
+// containers, perf_event_paranoid).
+class DtlbCounter {
+public:
+  DtlbCounter() : _fd(-1) {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    _fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+  ~DtlbCounter() {
+#if defined(__linux__)
+    if (_fd >= 0)
+      close(_fd);
+#endif
+  }
+
+  void start() {
+#if defined(__linux__)
+    if (_fd >= 0) {
+      ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  long long stop() {
+#if defined(__linux__)
+    long long count = 0;
+    if (_fd >= 0) {
+      ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(_fd, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count)))
+        return count;
+    }
+#endif
+    return -1;
+  }
+
+private:
+  int _fd;
+  DtlbCounter(const DtlbCounter&);
+  DtlbCounter& operator=(const DtlbCounter&);
+};
+
+// push_back from empty, so every reallocation is timed, then a strided
+// walk over the filled buffer where the page size decides the TLB misses.
+template <typename Vec, typename T>
+void run_mmap_case(const char* type, const char* name, const std::vector<T>& data,
+                   std::ofstream& out) {
+  DtlbCounter tlb;
+  Vec v;
+  tlb.start();
+  double time = measure_time([&]() {
+    for (std::size_t i = 0; i < data.size(); ++i)
+      v.push_back(data[i]);
+  });
+  long long misses = tlb.stop();
+  out << type << ",push_back," << data.size() << "," << name << "," << time << "," << misses
+      << "\n";
+
+  const std::size_t stride = 4096 / sizeof(T) + 1;
+  std::size_t touched = 0;
+  tlb.start();
+  time = measure_time([&]() {
+    for (std::size_t start = 0; start < stride; ++start)
+      for (std::size_t i = start; i < v.size(); i += stride)
+        touched += *reinterpret_cast<const unsigned char*>(&v[i]);
+  });
+  misses = tlb.stop();
+  if (touched == 1)
+    std::cerr << "\nmmap benchmark: unexpected checksum" << std::endl;
+  out << type << ",strided_read," << data.size() << "," << name << "," << time << "," << misses
+      << "\n";
+}
+
+template <typename T>
+void run_mmap_cases(const char* type, std::size_t count, std::ofstream& out) {
+  std::vector<T> data = generate_data<T>(count);
+
+  print_progress(0, 3, std::string("ft_mmap / ") + type + " / push_back [mmap]");
+  run_mmap_case<ft::vector<T, ft::mmap_allocator<T> > >(type, "ft_mmap", data, out);
+  print_progress(1, 3, std::string("ft / ") + type + " / push_back [mmap]");
+  run_mmap_case<ft::vector<T> >(type, "ft", data, out);
+  print_progress(2, 3, std::string("std / ") + type + " / push_back [mmap]");
+  run_mmap_case<std::vector<T> >(type, "std", data, out);
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+inline void run_mmap_benchmark(std::size_t count, std::ofstream& out) {
+  run_mmap_cases<int>("int", count, out);
+  run_mmap_cases<Point>("point", count, out);
+}
+
+} // namespace benchmark
@@ -0,0 +1,205 @@
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <sstream>
+#include "shared_utils.hpp"
+#include "concurrency/mpmc_queue.hpp"
+
+namespace benchmark {
+
+static const std::size_t MPMC_CAPACITY = 1024;
+static const std::size_t MPMC_BATCH = 32;
+
+// Baseline: bounded std::deque behind a std::mutex. Acquisitions that find
+// the lock already held are counted as contention.
+template <typename T>
+class LockedDeque {
+  std::mutex _lock;
+  std::deque<T> _queue;
+  std::size_t _capacity;
+  std::atomic<unsigned long> _contended;
+
+  void acquire() {
+    if (!_lock.try_lock()) {
+      _contended.fetch_add(1, std::memory_order_relaxed);
+      _lock.lock();
+    }
+  }
+
+public:
+  explicit LockedDeque(std::size_t capacity) : _capacity(capacity), _contended(0) {}
+
+  bool try_push(const T& val) {
+    acquire();
+    bool ok = _queue.size() < _capacity;
+    if (ok)
+      _queue.push_back(val);
+    _lock.unlock();
+    return ok;
+  }
+
+  std::size_t try_pop_n(T* dst, std::size_t n) {
+    acquire();
+    n = std::min(n, _queue.size());
+    std::copy(_queue.begin(), _queue.begin() + n, dst);
+    _queue.erase(_queue.begin(), _queue.begin() + n);
+    _lock.unlock();
+    return n;
+  }
+
+  bool try_pop(T& out) { return try_pop_n(&out, 1) == 1; }
+
+  unsigned long contended() const { return _contended.load(); }
+};
+
+enum MpmcMode { MPMC_MODE_TRY, MPMC_MODE_BATCH, MPMC_MODE_BLOCKING };
+
+template <typename Queue, typename T>
+void mpmc_push(Queue& q, const T& val, MpmcMode, unsigned long& retries) {
+  while (!q.try_push(val)) {
+    ++retries;
+    std::this_thread::yield();
+  }
+}
+
+template <typename T>
+void mpmc_push(ft::mpmc_queue<T>& q, const T& val, MpmcMode mode, unsigned long& retries) {
+  if (mode == MPMC_MODE_BLOCKING) {
+    q.push(val);
+    return;
+  }
+  while (!q.try_push(val)) {
+    ++retries;
+    std::this_thread::yield();
+  }
+}
+
+template <typename Queue, typename T>
+std::size_t mpmc_pop(Queue& q, T* out, std::size_t want, MpmcMode mode, unsigned long& retries) {
+  std::size_t n = mode == MPMC_MODE_BATCH ? std::min(want, MPMC_BATCH) : 1;
+  std::size_t got;
+  while ((got = q.try_pop_n(out, n)) == 0) {
+    ++retries;
+    std::this_thread::yield();
+  }
+  return got;
+}
+
+template <typename T>
+std::size_t mpmc_pop(ft::mpmc_queue<T>& q, T* out, std::size_t want, MpmcMode mode, unsigned long& retries) {
+  if (mode == MPMC_MODE_BLOCKING)
+    return q.pop_n(out, std::min(want, MPMC_BATCH));
+  std::size_t n = mode == MPMC_MODE_BATCH ? std::min(want, MPMC_BATCH) : 1;
+  std::size_t got;
+  while ((got = q.try_pop_n(out, n)) == 0) {
+    ++retries;
+    std::this_thread::yield();
+  }
+  return got;
+}
+
+template <typename Queue>
+unsigned long mpmc_contention(const Queue&) { return 0; }
+
+template <typename T>
+unsigned long mpmc_contention(const LockedDeque<T>& q) { return q.contended(); }
+
+// Every element of data crosses the queue exactly once. Producers and
+// consumers get fixed shares so the run terminates without a shutdown signal.
+// Returns wall time; retries collects failed try_* attempts plus lock
+// contention.
+template <typename Queue, typename T>
+double run_mpmc_case(const std::vector<T>& data, std::size_t producers, std::size_t consumers,
+                     MpmcMode mode, unsigned long& retries) {
+  Queue q(MPMC_CAPACITY);
+  std::atomic<unsigned long> total_retries(0);
+  std::atomic<long long> checksum(0);
+
+  double time = measure_wall_time([&]() {
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < producers; ++p) {
+      threads.push_back(std::thread([&, p]() {
+        unsigned long local = 0;
+        for (std::size_t i = p; i < data.size(); i += producers)
+          mpmc_push(q, data[i], mode, local);
+        total_retries += local;
+      }));
+    }
+    for (std::size_t c = 0; c < consumers; ++c) {
+      threads.push_back(std::thread([&, c]() {
+        unsigned long local = 0;
+        std::size_t quota = data.size() / consumers + (c == 0 ? data.size() % consumers : 0);
+        T buf[MPMC_BATCH];
+        long long sum = 0;
+        while (quota) {
+          std::size_t got = mpmc_pop(q, buf, quota, mode, local);
+          for (std::size_t i = 0; i < got; ++i)
+            sum += buf[i];
+          quota -= got;
+        }
+        checksum += sum;
+        total_retries += local;
+      }));
+    }
+    for (std::size_t i = 0; i < threads.size(); ++i)
+      threads[i].join();
+  });
+
+  long long expected = 0;
+  for (std::size_t i = 0; i < data.size(); ++i)
+    expected += data[i];
+  if (checksum.load() != expected)
+    std::cerr << "\nmpmc benchmark: checksum mismatch" << std::endl;
+
+  retries = total_retries.load() + mpmc_contention(q);
+  return time;
+}
+
+inline void run_mpmc_queue_benchmark(std::size_t count, std::ofstream& out) {
+  std::vector<int> data = generate_data<int>(count);
+  std::size_t max_threads = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t n = 1; n < max_threads; n *= 2)
+    thread_counts.push_back(n);
+  thread_counts.push_back(max_threads);
+
+  struct Variant { const char* ns; MpmcMode mode; bool locked; };
+  const Variant variants[] = {
+    { "ft", MPMC_MODE_TRY, false },
+    { "ft_batch", MPMC_MODE_BATCH, false },
+    { "ft_blocking", MPMC_MODE_BLOCKING, false },
+    { "mutex", MPMC_MODE_TRY, true },
+    { "mutex_batch", MPMC_MODE_BATCH, true },
+  };
+  const std::size_t num_variants = sizeof(variants) / sizeof(variants[0]);
+  std::size_t total = thread_counts.size() * thread_counts.size() * num_variants;
+  std::size_t done = 0;
+
+  for (std::size_t pi = 0; pi < thread_counts.size(); ++pi) {
+    for (std::size_t ci = 0; ci < thread_counts.size(); ++ci) {
+      std::size_t producers = thread_counts[pi];
+      std::size_t consumers = thread_counts[ci];
+      std::ostringstream fn;
+      fn << "p" << producers << "_c" << consumers;
+
+      for (std::size_t v = 0; v < num_variants; ++v) {
+        std::ostringstream label;
+        label << variants[v].ns << " / int / " << count << " / " << fn.str() << " [mpmc_queue]";
+        print_progress(done++, total, label.str());
+
+        unsigned long retries = 0;
+        double time = variants[v].locked
+          ? run_mpmc_case<LockedDeque<int> >(data, producers, consumers, variants[v].mode, retries)
+          : run_mpmc_case<ft::mpmc_queue<int> >(data, producers, consumers, variants[v].mode, retries);
+
+        out << "int," << fn.str() << "," << count << "," << variants[v].ns << "," << time
+            << "," << (time > 0 ? count / time : 0) << "," << retries << "\n";
+        std::cout << "\r" << std::string(80, ' ') << "\r";
+      }
+    }
+  }
+}
+
+} // namespace benchmark
@@ -0,0 +1,97 @@
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "packed_vector.hpp"
+
+namespace benchmark {
+
+template <typename Seq>
+long long packed_scan(const Seq& seq) {
+  long long sum = 0;
+  for (typename Seq::const_iterator it = seq.begin(); it != seq.end(); ++it)
+    sum += *it;
+  return sum;
+}
+
+// Decodes into out (ft::vector copies, as the baseline for decoding).
+inline void packed_decode(const ft::vector<int>& v, int* out) {
+  if (!v.empty())
+    std::memcpy(out, &v[0], v.size() * sizeof(int));
+}
+
+template <typename Packed>
+void packed_decode(const Packed& p, int* out) {
+  p.copy_to(out);
+}
+
+template <typename Seq>
+void run_packed_cases(const char* type, const char* ns, const std::vector<int>& data,
+                      const Seq& seq, double bytes, std::size_t reps, std::ofstream& out,
+                      std::size_t& done) {
+  static const char* functions[] = { "decode", "scan", "random_access" };
+  std::size_t count = data.size();
+  std::vector<int> buffer(count + 1);
+  std::vector<std::size_t> probes(1024);
+  for (std::size_t i = 0; i < probes.size(); ++i)
+    probes[i] = count ? static_cast<std::size_t>(std::rand()) % count : 0;
+  long long sink = 0;
+
+  for (int f = 0; f < 3; ++f) {
+    print_progress(done++, 24, std::string(ns) + " / " + type + " / " + functions[f] + " [packed]");
+    double time = measure_time([&]() {
+      for (std::size_t r = 0; r < reps; ++r) {
+        if (f == 0) {
+          packed_decode(seq, &buffer[0]);
+          sink += buffer[r % (count ? count : 1)];
+        } else if (f == 1) {
+          sink += packed_scan(seq);
+        } else if (count) {
+          for (std::size_t i = 0; i < probes.size(); ++i)
+            sink += seq[probes[i]];
+        }
+      }
+    });
+    out << type << "," << functions[f] << "," << count << "," << ns << "," << time << ","
+        << (count ? bytes / count : 0) << "\n";
+  }
+  if (sink == -1)
+    std::cerr << "\npacked benchmark: unexpected checksum" << std::endl;
+}
+
+// Sorted IDs and small-range values, stored plain, bit-packed at a
+// per-block width, and frame-of-reference coded; the scalar variant caps
+// the unpacking at portable code. BytesPerElement counts the heap storage.
+inline void run_packed_benchmark(std::size_t count, std::ofstream& out) {
+  static const char* types[] = { "sorted_ids", "small_range" };
+  std::size_t reps = (std::size_t(1) << 23) / (count ? count : 1);
+  if (!reps)
+    reps = 1;
+  std::size_t done = 0;
+
+  for (int t = 0; t < 2; ++t) {
+    std::vector<int> data(count);
+    int id = 1000000;
+    for (std::size_t i = 0; i < count; ++i)
+      data[i] = t == 0 ? (id += 1 + std::rand() % 4) : std::rand() % 1000;
+
+    ft::vector<int> plain(data.begin(), data.end());
+    ft::packed_vector<int, ft::fixed_width> fixed(data.begin(), data.end());
+    ft::packed_vector<int> frame(data.begin(), data.end());
+
+    run_packed_cases(types[t], "ft_vector", data, plain, double(plain.capacity() * sizeof(int)),
+                     reps, out, done);
+    run_packed_cases(types[t], "ft_packed_fixed", data, fixed, double(fixed.bytes_used()),
+                     reps, out, done);
+    run_packed_cases(types[t], "ft_packed_frame", data, frame, double(frame.bytes_used()),
+                     reps, out, done);
+    ft::set_simd_level(ft::SIMD_SCALAR);
+    run_packed_cases(types[t], "ft_packed_frame_scalar", data, frame, double(frame.bytes_used()),
+                     reps, out, done);
+    ft::set_simd_level(ft::SIMD_AVX2);
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
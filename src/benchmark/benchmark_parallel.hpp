@@ -0,0 +1,161 @@
+#include <thread>
+#include <sstream>
+#include <algorithm>
+#include <numeric>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "concurrency/parallel_algorithm.hpp"
+
+namespace benchmark {
+
+// Sizes past the harness defaults (10^7, 10^8) cost gigabytes and minutes,
+// so they only run when FT_BENCH_LARGE is set in the environment.
+inline bool large_runs_enabled() {
+  const char* env = std::getenv("FT_BENCH_LARGE");
+  return env && *env && std::string(env) != "0";
+}
+
+// Per-type hooks for the scan workloads. Point reduces with a componentwise
+// max so large inputs cannot overflow.
+template <typename T>
+struct ParallelOps;
+
+template <>
+struct ParallelOps<int> {
+  typedef long long acc_type;
+  static const char* name() { return "int"; }
+  static void touch(int& v) { v ^= 1; }
+  static int transform(int v) { return v * 3 + 1; }
+  static bool pred(int v) { return (v & 7) == 0; }
+  struct combine {
+    long long operator()(long long a, long long b) const { return a + b; }
+  };
+  static acc_type init() { return 0; }
+};
+
+template <>
+struct ParallelOps<Point> {
+  typedef Point acc_type;
+  static const char* name() { return "point"; }
+  static void touch(Point& p) { ++p.y; }
+  static Point transform(const Point& p) { return Point(p.y, p.x); }
+  static bool pred(const Point& p) { return p.x < 100; }
+  struct combine {
+    Point operator()(const Point& a, const Point& b) const {
+      return Point(std::max(a.x, b.x), std::max(a.y, b.y));
+    }
+  };
+  static acc_type init() { return Point(); }
+};
+
+template <typename T>
+void run_parallel_cases(std::size_t count, std::ofstream& out,
+                        const std::vector<std::size_t>& thread_counts) {
+  typedef ParallelOps<T> ops;
+  typedef typename ops::acc_type acc_type;
+  static const char* functions[] = { "sort", "for_each", "transform", "reduce", "count_if", "copy" };
+  static const std::size_t num_functions = sizeof(functions) / sizeof(functions[0]);
+
+  std::vector<T> data = generate_data<T>(count);
+  ft::vector<T> vec(data.begin(), data.end());
+  ft::vector<T> dst(count);
+  std::vector<double> serial(num_functions);
+  volatile long long sink = 0;
+
+  std::size_t total = num_functions * (thread_counts.size() + 1);
+  std::size_t done = 0;
+
+  // exec == NULL times the serial std:: algorithm on the same ft::vector
+  for (std::size_t t = 0; t <= thread_counts.size(); ++t) {
+    std::unique_ptr<ft::parallel_executor> exec;
+    std::string ns = "serial";
+    if (t > 0) {
+      exec.reset(new ft::parallel_executor(thread_counts[t - 1]));
+      exec->pool().run([]() {});  // wake the workers before timing
+      std::ostringstream label;
+      label << "ft_" << thread_counts[t - 1] << "t";
+      ns = label.str();
+    }
+
+    for (std::size_t f = 0; f < num_functions; ++f) {
+      std::ostringstream label;
+      label << ns << " / " << ops::name() << " / " << count << " / " << functions[f] << " [parallel]";
+      print_progress(done++, total, label.str());
+
+      std::copy(data.begin(), data.end(), vec.begin());
+      double time = 0;
+      switch (f) {
+        case 0:
+          time = measure_wall_time([&]() {
+            if (exec)
+              ft::parallel_sort(*exec, vec.begin(), vec.end(), std::less<T>());
+            else
+              std::sort(vec.begin(), vec.end());
+          });
+          if (!std::is_sorted(vec.begin(), vec.end()))
+            std::cerr << "\nparallel benchmark: sort produced unsorted output" << std::endl;
+          break;
+        case 1:
+          time = measure_wall_time([&]() {
+            if (exec)
+              ft::parallel_for_each(*exec, vec.begin(), vec.end(), ops::touch);
+            else
+              std::for_each(vec.begin(), vec.end(), ops::touch);
+          });
+          break;
+        case 2:
+          time = measure_wall_time([&]() {
+            if (exec)
+              ft::parallel_transform(*exec, vec.begin(), vec.end(), dst.begin(), ops::transform);
+            else
+              std::transform(vec.begin(), vec.end(), dst.begin(), ops::transform);
+          });
+          break;
+        case 3:
+          time = measure_wall_time([&]() {
+            typename ops::combine op;
+            acc_type r = exec
+              ? ft::parallel_reduce(*exec, vec.begin(), vec.end(), ops::init(), op)
+              : std::accumulate(vec.begin(), vec.end(), ops::init(), op);
+            sink = sink + (r == acc_type());
+          });
+          break;
+        case 4:
+          time = measure_wall_time([&]() {
+            sink = sink + (exec
+              ? ft::parallel_count_if(*exec, vec.begin(), vec.end(), ops::pred)
+              : std::count_if(vec.begin(), vec.end(), ops::pred));
+          });
+          break;
+        case 5:
+          time = measure_wall_time([&]() {
+            if (exec)
+              ft::parallel_copy(*exec, vec.begin(), vec.end(), dst.begin());
+            else
+              std::copy(vec.begin(), vec.end(), dst.begin());
+          });
+          break;
+      }
+
+      if (t == 0)
+        serial[f] = time;
+      out << ops::name() << "," << functions[f] << "," << count << "," << ns << "," << time
+          << "," << (time > 0 ? serial[f] / time : 0) << "\n";
+    }
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+// Speedup over the serial std:: algorithm at 1, 2, 4, ... hardware threads.
+inline void run_parallel_benchmark(std::size_t count, std::ofstream& out) {
+  std::size_t max_threads = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t n = 1; n < max_threads; n *= 2)
+    thread_counts.push_back(n);
+  thread_counts.push_back(max_threads);
+
+  run_parallel_cases<int>(count, out, thread_counts);
+  run_parallel_cases<Point>(count, out, thread_counts);
+}
+
+} // namespace benchmark
@@ -0,0 +1,82 @@
+#include <deque>
+#include "ContainerBenchmark.hpp"
+#include "ring_buffer.hpp"
+
+namespace benchmark {
+
+// Sliding telemetry window of the most recent WINDOW samples.
+static const std::size_t WINDOW = 4096;
+static const std::size_t CHUNK = 256;
+
+template <typename T>
+struct RingWindow {
+  ft::ring_buffer<T> buf;
+
+  RingWindow() : buf(WINDOW, true) {}
+
+  void push(const T& val) { buf.push_back(val); }
+  void push_n(const T* src, std::size_t n) { buf.push_back_n(src, n); }
+  std::size_t drop_n(T* dst, std::size_t n) { return buf.pop_front_n(dst, n); }
+  std::size_t size() const { return buf.size(); }
+  const T& operator[](std::size_t i) const { return buf[i]; }
+};
+
+template <typename T>
+struct DequeWindow {
+  std::deque<T> buf;
+
+  void push(const T& val) {
+    if (buf.size() == WINDOW)
+      buf.pop_front();
+    buf.push_back(val);
+  }
+
+  void push_n(const T* src, std::size_t n) {
+    buf.insert(buf.end(), src, src + n);
+    if (buf.size() > WINDOW)
+      buf.erase(buf.begin(), buf.begin() + (buf.size() - WINDOW));
+  }
+
+  std::size_t drop_n(T* dst, std::size_t n) {
+    n = std::min(n, buf.size());
+    std::copy(buf.begin(), buf.begin() + n, dst);
+    buf.erase(buf.begin(), buf.begin() + n);
+    return n;
+  }
+
+  std::size_t size() const { return buf.size(); }
+  const T& operator[](std::size_t i) const { return buf[i]; }
+};
+
+} // namespace benchmark
+
+template <typename Window, typename T>
+void register_ring_buffer_tests(benchmark::ContainerBenchmark<Window, T>& bench) {
+  bench.add("push_window", [](Window& w, const std::vector<T>& data) {
+    for (std::size_t i = 0; i < data.size(); ++i)
+      w.push(data[i]);
+  });
+
+  bench.add("push_window_bulk", [](Window& w, const std::vector<T>& data) {
+    for (std::size_t i = 0; i < data.size(); i += benchmark::CHUNK)
+      w.push_n(&data[i], std::min(benchmark::CHUNK, data.size() - i));
+  });
+
+  bench.add("push_drain_bulk", [](Window& w, const std::vector<T>& data) {
+    T out[benchmark::CHUNK];
+    for (std::size_t i = 0; i < data.size(); i += benchmark::CHUNK) {
+      w.push_n(&data[i], std::min(benchmark::CHUNK, data.size() - i));
+      w.drop_n(out, benchmark::CHUNK / 2);
+    }
+    while (w.drop_n(out, benchmark::CHUNK))
+      ;
+  });
+
+  bench.add("scan_window", [](Window& w, const std::vector<T>& data) {
+    for (std::size_t i = 0; i < data.size(); ++i)
+      w.push(data[i]);
+    for (std::size_t i = 0; i < w.size(); ++i) {
+      volatile T x = w[i];
+    }
+  });
+}
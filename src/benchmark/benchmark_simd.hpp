@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+
+namespace benchmark {
+
+// Scans are too short to time once at the harness sizes, so every kernel is
+// repeated until it has touched about 2^24 elements.
+inline std::size_t simd_repeats(std::size_t count) {
+  std::size_t reps = (std::size_t(1) << 24) / (count ? count : 1);
+  return reps ? reps : 1;
+}
+
+template <typename T>
+void run_simd_cases(const char* type, std::size_t count, std::ofstream& out) {
+  static const char* functions[] = { "find", "count", "min_element", "max_element",
+                                     "equal", "operator==", "operator<" };
+  static const char* namespaces[] = { "ft_scalar", "ft_sse2", "ft_avx2", "std" };
+  const int function_count = 7;
+  const std::size_t reps = simd_repeats(count);
+
+  std::vector<T> data = generate_data<T>(count);
+  // The searched value only appears in the last slot, so find scans everything
+  T missing = *std::max_element(data.begin(), data.end()) + 1;
+  data.back() = missing;
+  ft::vector<T> ft_a(data.begin(), data.end());
+  ft::vector<T> ft_b(ft_a);
+  std::vector<T> std_b(data);
+
+  std::size_t total = function_count * 4;
+  std::size_t done = 0;
+  long long sink = 0;
+
+  for (int f = 0; f < function_count; ++f) {
+    for (int ns = 0; ns < 4; ++ns) {
+      print_progress(done++, total, std::string(namespaces[ns]) + " / " + type + " / " +
+                                        functions[f] + " [simd]");
+      if (ns < 3)
+        ft::set_simd_level(ns);
+      bool is_std = ns == 3;
+      double time = measure_time([&]() {
+        for (std::size_t r = 0; r < reps; ++r) {
+          switch (f) {
+            case 0:
+              sink += is_std ? std::find(data.begin(), data.end(), missing) - data.begin()
+                             : ft::find(ft_a.begin(), ft_a.end(), missing) - ft_a.begin();
+              break;
+            case 1:
+              sink += is_std ? std::count(data.begin(), data.end(), data[r % count])
+                             : ft::count(ft_a.begin(), ft_a.end(), ft_a[r % count]);
+              break;
+            case 2:
+              sink += is_std ? std::min_element(data.begin(), data.end()) - data.begin()
+                             : ft::min_element(ft_a.begin(), ft_a.end()) - ft_a.begin();
+              break;
+            case 3:
+              sink += is_std ? std::max_element(data.begin(), data.end()) - data.begin()
+                             : ft::max_element(ft_a.begin(), ft_a.end()) - ft_a.begin();
+              break;
+            case 4:
+              sink += is_std ? std::equal(data.begin(), data.end(), std_b.begin())
+                             : ft::equal(ft_a.begin(), ft_a.end(), ft_b.begin());
+              break;
+            case 5:
+              sink += is_std ? data == std_b : ft_a == ft_b;
+              break;
+            case 6:
+              sink += is_std ? data < std_b : ft_a < ft_b;
+              break;
+          }
+        }
+      });
+      out << type << "," << functions[f] << "," << count << "," << namespaces[ns] << ","
+          << time << "\n";
+    }
+  }
+  ft::set_simd_level(ft::SIMD_AVX2);
+  if (sink == -1)
+    std::cerr << "\nsimd benchmark: unexpected checksum" << std::endl;
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+inline void run_simd_benchmark(std::size_t count, std::ofstream& out) {
+  run_simd_cases<int>("int", count, out);
+}
+
+} // namespace benchmark
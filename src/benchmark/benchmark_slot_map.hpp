@@ -0,0 +1,92 @@
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include <unordered_map>
+#include "shared_utils.hpp"
+#include "slot_map.hpp"
+#include "Point.hpp"
+
+namespace benchmark {
+
+// Entity tables of Points: ft::slot_map addressed by its keys, and
+// std::unordered_map addressed by sequential ids. lookup reads count
+// random entries, iterate sums every x, erase_insert replaces a quarter
+// of the entries in random order.
+inline void run_slot_map_benchmark(std::size_t count, std::ofstream& out) {
+  typedef ft::slot_map<Point> table;
+  typedef std::unordered_map<unsigned int, Point> hash_table;
+  static const char* functions[] = { "insert", "lookup", "iterate", "erase_insert" };
+  static const char* namespaces[] = { "ft_slot_map", "std_unordered_map" };
+  std::size_t reps = (std::size_t(1) << 20) / (count ? count : 1);
+  if (!reps)
+    reps = 1;
+
+  std::vector<Point> data = generate_data<Point>(count);
+  std::vector<std::size_t> probes(count);
+  for (std::size_t i = 0; i < count; ++i)
+    probes[i] = static_cast<std::size_t>(std::rand()) % count;
+  long long sink = 0;
+  std::size_t done = 0;
+
+  for (int f = 0; f < 4; ++f) {
+    for (int ns = 0; ns < 2; ++ns) {
+      print_progress(done++, 8, std::string(namespaces[ns]) + " / point / " + functions[f] + " [slot_map]");
+      double time = 0;
+      for (std::size_t r = 0; r < reps; ++r) {
+        table slots;
+        hash_table hashed;
+        std::vector<table::key_type> keys(count);
+        std::vector<unsigned int> ids(count);
+        unsigned int next_id = 0;
+        double t = measure_time([&]() {
+          for (std::size_t i = 0; i < count; ++i) {
+            if (ns == 0) {
+              keys[i] = slots.insert(data[i]);
+            } else {
+              ids[i] = next_id++;
+              hashed.insert(std::make_pair(ids[i], data[i]));
+            }
+          }
+        });
+        if (f == 0) {
+          time += t;
+          continue;
+        }
+        time += measure_time([&]() {
+          if (f == 1) {
+            for (std::size_t i = 0; i < count; ++i)
+              sink += ns == 0 ? slots[keys[probes[i]]].x : hashed.find(ids[probes[i]])->second.x;
+          } else if (f == 2) {
+            if (ns == 0) {
+              for (table::const_iterator it = slots.begin(); it != slots.end(); ++it)
+                sink += it->x;
+            } else {
+              for (hash_table::const_iterator it = hashed.begin(); it != hashed.end(); ++it)
+                sink += it->second.x;
+            }
+          } else {
+            for (std::size_t i = 0; i < count / 4; ++i) {
+              std::size_t k = probes[i];
+              if (ns == 0) {
+                if (slots.contains(keys[k]))
+                  slots.erase(keys[k]);
+                keys[k] = slots.insert(data[i]);
+              } else {
+                hashed.erase(ids[k]);
+                ids[k] = next_id++;
+                hashed.insert(std::make_pair(ids[k], data[i]));
+              }
+            }
+          }
+        });
+        sink += ns == 0 ? slots.size() : hashed.size();
+      }
+      out << "point," << functions[f] << "," << count << "," << namespaces[ns] << "," << time << "\n";
+    }
+  }
+  if (sink == -1)
+    std::cerr << "\nslot_map benchmark: unexpected checksum" << std::endl;
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
@@ -0,0 +1,65 @@
+#include <sstream>
+#include <vector>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "small_vector.hpp"
+#include "static_vector.hpp"
+
+namespace benchmark {
+
+// Builds, reads and drops count short-lived containers of length elements
+// each: the per-request pattern small_vector targets.
+template <typename Container, typename T>
+std::size_t churn(const std::vector<T>& data, std::size_t count, std::size_t length) {
+  std::size_t touched = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    Container c;
+    for (std::size_t j = 0; j < length; ++j)
+      c.push_back(data[(i + j) % data.size()]);
+    touched += c.size();
+  }
+  return touched;
+}
+
+template <typename T>
+void run_small_vector_cases(const char* type, std::size_t count, std::ofstream& out) {
+  typedef ft::small_vector<T, 16, CountingAllocator<T> > small_type;
+  typedef ft::vector<T, CountingAllocator<T> >           ft_type;
+  typedef std::vector<T, CountingAllocator<T> >          std_type;
+  typedef ft::static_vector<T, 32>                       static_type;
+  static const std::size_t lengths[] = { 4, 8, 16, 32 };
+  static const char* names[] = { "ft_small_16", "ft_static_32", "ft", "std" };
+  std::vector<T> data = generate_data<T>(64);
+  std::size_t done = 0;
+
+  for (int l = 0; l < 4; ++l) {
+    std::ostringstream fn;
+    fn << "push_back_" << lengths[l];
+    for (int variant = 0; variant < 4; ++variant) {
+      print_progress(done++, 16, std::string(names[variant]) + " / " + type + " / " + fn.str() +
+                                     " [small_vector]");
+      allocation_count() = 0;
+      std::size_t touched = 0;
+      double time = measure_time([&]() {
+        switch (variant) {
+          case 0: touched = churn<small_type>(data, count, lengths[l]); break;
+          case 1: touched = churn<static_type>(data, count, lengths[l]); break;
+          case 2: touched = churn<ft_type>(data, count, lengths[l]); break;
+          case 3: touched = churn<std_type>(data, count, lengths[l]); break;
+        }
+      });
+      if (touched != count * lengths[l])
+        std::cerr << "\nsmall_vector benchmark: wrong element count" << std::endl;
+      out << type << "," << fn.str() << "," << count << "," << names[variant] << "," << time << ","
+          << allocation_count() << "\n";
+    }
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+inline void run_small_vector_benchmark(std::size_t count, std::ofstream& out) {
+  run_small_vector_cases<int>("int", count, out);
+  run_small_vector_cases<Point>("point", count, out);
+}
+
+} // namespace benchmark
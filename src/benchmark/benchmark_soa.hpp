@@ -0,0 +1,106 @@
+#include <sstream>
+#include <vector>
+#include <limits>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+#include "soa_vector.hpp"
+#include "Point.hpp"
+
+namespace ft {
+
+template <>
+struct soa_traits<Point> {
+  typedef soa_fields<soa_field<Point, int, &Point::x>,
+                     soa_field<Point, int, &Point::y> > fields;
+};
+
+} // namespace ft
+
+namespace benchmark {
+
+struct PointXLess {
+  bool operator()(const Point& a, const Point& b) const { return a.x < b.x; }
+};
+
+template <typename It>
+long long sum_of(It first, It last) {
+  long long sum = 0;
+  for (; first != last; ++first)
+    sum += *first;
+  return sum;
+}
+
+template <typename It>
+int max_of(It first, It last) {
+  int best = std::numeric_limits<int>::min();
+  for (; first != last; ++first)
+    best = *first > best ? *first : best;
+  return best;
+}
+
+// Points as an array of structs (ft::vector<Point>) and as a structure of
+// arrays (ft::soa_vector<Point>): reductions that read one field, and a
+// stable sort by x.
+inline void run_soa_benchmark(std::size_t count, std::ofstream& out) {
+  static const char* functions[] = { "sum_x", "max_y", "sort_x" };
+  static const char* namespaces[] = { "ft_vector", "ft_soa" };
+  std::size_t reps = (std::size_t(1) << 24) / (count ? count : 1);
+  if (!reps)
+    reps = 1;
+  std::size_t sort_reps = reps / 64 ? reps / 64 : 1;
+
+  std::vector<Point> data = generate_data<Point>(count);
+  ft::vector<Point> aos(data.begin(), data.end());
+  ft::soa_vector<Point> soa;
+  for (std::size_t i = 0; i < count; ++i)
+    soa.push_back(data[i]);
+  long long sink = 0;
+  std::size_t done = 0;
+
+  for (int f = 0; f < 3; ++f) {
+    for (int ns = 0; ns < 2; ++ns) {
+      print_progress(done++, 6, std::string(namespaces[ns]) + " / point / " + functions[f] + " [soa]");
+      double time = 0;
+      if (f < 2) {
+        time = measure_time([&]() {
+          for (std::size_t r = 0; r < reps; ++r) {
+            if (ns == 0 && f == 0) {
+              long long sum = 0;
+              for (std::size_t i = 0; i < count; ++i)
+                sum += aos[i].x;
+              sink += sum;
+            } else if (ns == 0) {
+              int best = std::numeric_limits<int>::min();
+              for (std::size_t i = 0; i < count; ++i)
+                best = aos[i].y > best ? aos[i].y : best;
+              sink += best;
+            } else if (f == 0) {
+              sink += sum_of(soa.field<0>().begin(), soa.field<0>().end());
+            } else {
+              sink += max_of(soa.field<1>().begin(), soa.field<1>().end());
+            }
+          }
+        });
+      } else {
+        for (std::size_t r = 0; r < sort_reps; ++r) {
+          if (ns == 0) {
+            ft::vector<Point> v(aos);
+            time += measure_time([&]() { ft::stable_sort(v.begin(), v.end(), PointXLess()); });
+            sink += count ? v[count / 2].x : 0;
+          } else {
+            ft::soa_vector<Point> v(soa);
+            time += measure_time([&]() { v.sort_by<0>(); });
+            sink += count ? v.field<0>()[count / 2] : 0;
+          }
+        }
+      }
+      out << "point," << functions[f] << "," << count << "," << namespaces[ns] << "," << time << "\n";
+    }
+  }
+  if (sink == -1)
+    std::cerr << "\nsoa benchmark: unexpected checksum" << std::endl;
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
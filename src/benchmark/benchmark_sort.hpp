@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+
+namespace benchmark {
+
+enum SortShape { SORT_RANDOM, SORT_SORTED, SORT_REVERSED, SORT_FEW_UNIQUE };
+
+// Reshapes generated data into one of the distributions sorting sees in
+// practice. Few-unique keeps only four distinct values.
+template <typename T>
+std::vector<T> shape_sort_input(const std::vector<T>& data, SortShape shape) {
+  std::vector<T> out(data);
+  switch (shape) {
+    case SORT_RANDOM:
+      break;
+    case SORT_SORTED:
+      std::sort(out.begin(), out.end());
+      break;
+    case SORT_REVERSED:
+      std::sort(out.begin(), out.end());
+      std::reverse(out.begin(), out.end());
+      break;
+    case SORT_FEW_UNIQUE:
+      for (std::size_t i = 0; i < out.size(); ++i)
+        out[i] = data[rand() % std::min<std::size_t>(4, data.size())];
+      break;
+  }
+  return out;
+}
+
+template <typename T>
+void run_sort_cases(const char* type, std::size_t count, std::ofstream& out) {
+  static const char* shape_names[] = { "random", "sorted", "reversed", "few_unique" };
+  std::vector<T> data = generate_data<T>(count);
+  std::size_t total = 4 * 4;
+  std::size_t done = 0;
+
+  for (int s = 0; s < 4; ++s) {
+    std::vector<T> input = shape_sort_input(data, static_cast<SortShape>(s));
+    for (int stable = 0; stable < 2; ++stable) {
+      std::string fn = std::string(stable ? "stable_sort_" : "sort_") + shape_names[s];
+
+      print_progress(done++, total, std::string("ft / ") + type + " / " + fn + " [sort]");
+      ft::vector<T> ft_vec(input.begin(), input.end());
+      double ft_time = measure_time([&]() {
+        if (stable)
+          ft::stable_sort(ft_vec.begin(), ft_vec.end());
+        else
+          ft::sort(ft_vec.begin(), ft_vec.end());
+      });
+
+      print_progress(done++, total, std::string("std / ") + type + " / " + fn + " [sort]");
+      std::vector<T> std_vec(input);
+      double std_time = measure_time([&]() {
+        if (stable)
+          std::stable_sort(std_vec.begin(), std_vec.end());
+        else
+          std::sort(std_vec.begin(), std_vec.end());
+      });
+
+      if (!std::equal(std_vec.begin(), std_vec.end(), ft_vec.begin()))
+        std::cerr << "\nsort benchmark: ft and std results differ" << std::endl;
+
+      out << type << "," << fn << "," << count << ",ft," << ft_time << "\n";
+      out << type << "," << fn << "," << count << ",std," << std_time << "\n";
+    }
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+// Radix sort keys: ints sort on themselves, Points on (x, y) packed into
+// 64 bits, which orders like Point::operator<.
+struct PointKey {
+  typedef unsigned long long result_type;
+  unsigned long long operator()(const Point& p) const {
+    return (static_cast<unsigned long long>(static_cast<unsigned>(p.x) ^ 0x80000000u) << 32) |
+           (static_cast<unsigned>(p.y) ^ 0x80000000u);
+  }
+};
+
+template <typename T>
+void radix_sort_with_key(ft::vector<T>& v, bool in_place) {
+  if (in_place)
+    ft::radix_sort_in_place(v.begin(), v.end());
+  else
+    ft::radix_sort(v.begin(), v.end());
+}
+
+inline void radix_sort_with_key(ft::vector<Point>& v, bool in_place) {
+  if (in_place)
+    ft::radix_sort_in_place(v.begin(), v.end(), PointKey());
+  else
+    ft::radix_sort(v.begin(), v.end(), PointKey());
+}
+
+// Radix sorts against ft::sort and std::sort on random input.
+template <typename T>
+void run_radix_sort_cases(const char* type, std::size_t count, std::ofstream& out) {
+  static const char* names[] = { "ft_radix", "ft_radix_in_place", "ft", "std" };
+  std::vector<T> data = generate_data<T>(count);
+  std::vector<T> expected(data);
+  std::sort(expected.begin(), expected.end());
+
+  for (int variant = 0; variant < 4; ++variant) {
+    print_progress(variant, 4, std::string(names[variant]) + " / " + type + " / radix_sort [sort]");
+    ft::vector<T> vec(data.begin(), data.end());
+    double time = measure_time([&]() {
+      switch (variant) {
+        case 0: radix_sort_with_key(vec, false); break;
+        case 1: radix_sort_with_key(vec, true); break;
+        case 2: ft::sort(vec.begin(), vec.end()); break;
+        case 3: std::sort(vec.begin(), vec.end()); break;
+      }
+    });
+    if (!std::equal(expected.begin(), expected.end(), vec.begin()))
+      std::cerr << "\nsort benchmark: " << names[variant] << " result differs" << std::endl;
+    out << type << ",radix_sort," << count << "," << names[variant] << "," << time << "\n";
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+inline void run_radix_sort_benchmark(std::size_t count, std::ofstream& out) {
+  run_radix_sort_cases<int>("int", count, out);
+  run_radix_sort_cases<Point>("point", count, out);
+}
+
+inline void run_sort_benchmark(std::size_t count, std::ofstream& out) {
+  run_sort_cases<int>("int", count, out);
+  run_sort_cases<std::string>("string", count, out);
+  run_sort_cases<Point>("point", count, out);
+  run_radix_sort_benchmark(count, out);
+}
+
+} // namespace benchmark
@@ -0,0 +1,128 @@
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "ContainerBenchmark.hpp"
+#include "concurrency/spsc_queue.hpp"
+
+namespace benchmark {
+
+static const std::size_t SPSC_CAPACITY = 1024;
+static const std::size_t SPSC_BATCH = 64;
+
+// Baseline: bounded std::deque behind a std::mutex, same try_* interface.
+template <typename T>
+class MutexQueue {
+  std::mutex _lock;
+  std::deque<T> _queue;
+
+public:
+  bool try_push(const T& val) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_queue.size() == SPSC_CAPACITY)
+      return false;
+    _queue.push_back(val);
+    return true;
+  }
+
+  std::size_t try_push_n(const T* src, std::size_t n) {
+    std::lock_guard<std::mutex> guard(_lock);
+    n = std::min(n, SPSC_CAPACITY - _queue.size());
+    _queue.insert(_queue.end(), src, src + n);
+    return n;
+  }
+
+  bool try_pop(T& out) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_queue.empty())
+      return false;
+    out = _queue.front();
+    _queue.pop_front();
+    return true;
+  }
+
+  std::size_t try_pop_n(T* dst, std::size_t n) {
+    std::lock_guard<std::mutex> guard(_lock);
+    n = std::min(n, _queue.size());
+    std::copy(_queue.begin(), _queue.begin() + n, dst);
+    _queue.erase(_queue.begin(), _queue.begin() + n);
+    return n;
+  }
+};
+
+// A request and a reply queue, so round trips can be timed.
+template <typename T>
+struct SpscChannel {
+  ft::spsc_queue<T> fwd;
+  ft::spsc_queue<T> back;
+
+  SpscChannel() : fwd(SPSC_CAPACITY), back(SPSC_CAPACITY) {}
+};
+
+template <typename T>
+struct MutexChannel {
+  MutexQueue<T> fwd;
+  MutexQueue<T> back;
+};
+
+} // namespace benchmark
+
+template <typename Channel, typename T>
+void register_spsc_queue_tests(benchmark::ContainerBenchmark<Channel, T>& bench) {
+  bench.use_wall_clock();
+
+  // One producer thread streams every element to the consumer (this thread)
+  bench.add("throughput", [](Channel& c, const std::vector<T>& data) {
+    std::thread producer([&]() {
+      for (std::size_t i = 0; i < data.size(); ++i)
+        while (!c.fwd.try_push(data[i]))
+          std::this_thread::yield();
+    });
+    T out;
+    for (std::size_t i = 0; i < data.size(); ++i)
+      while (!c.fwd.try_pop(out))
+        std::this_thread::yield();
+    producer.join();
+  });
+
+  bench.add("throughput_batch", [](Channel& c, const std::vector<T>& data) {
+    std::thread producer([&]() {
+      std::size_t i = 0;
+      while (i < data.size()) {
+        std::size_t n = c.fwd.try_push_n(&data[i], std::min(benchmark::SPSC_BATCH, data.size() - i));
+        if (n == 0)
+          std::this_thread::yield();
+        i += n;
+      }
+    });
+    T out[benchmark::SPSC_BATCH];
+    std::size_t received = 0;
+    while (received < data.size()) {
+      std::size_t n = c.fwd.try_pop_n(out, benchmark::SPSC_BATCH);
+      if (n == 0)
+        std::this_thread::yield();
+      received += n;
+    }
+    producer.join();
+  });
+
+  // Latency: each element makes a round trip through an echo thread
+  bench.add("ping_pong", [](Channel& c, const std::vector<T>& data) {
+    std::thread echo([&]() {
+      T val;
+      for (std::size_t i = 0; i < data.size(); ++i) {
+        while (!c.fwd.try_pop(val))
+          std::this_thread::yield();
+        while (!c.back.try_push(val))
+          std::this_thread::yield();
+      }
+    });
+    T val;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      while (!c.fwd.try_push(data[i]))
+        std::this_thread::yield();
+      while (!c.back.try_pop(val))
+        std::this_thread::yield();
+    }
+    echo.join();
+  });
+}
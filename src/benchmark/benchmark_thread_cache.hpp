@@ -0,0 +1,113 @@
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "shared_utils.hpp"
+#include "list.hpp"
+#include "deque.hpp"
+#include "concurrency/spsc_queue.hpp"
+#include "memory/thread_cache_allocator.hpp"
+
+namespace benchmark {
+
+// Thread counts from 1 up to the core count, doubling, at least up to 4.
+inline std::vector<std::size_t> thread_cache_thread_counts() {
+  std::size_t cores = std::thread::hardware_concurrency();
+  std::vector<std::size_t> counts;
+  for (std::size_t n = 1; n <= (cores > 4 ? cores : 4); n *= 2)
+    counts.push_back(n);
+  return counts;
+}
+
+// Every thread fills and empties lists of 64 nodes and builds and drops
+// 256-element deques, rounds times.
+template <typename Alloc>
+void container_churn(std::size_t rounds) {
+  typedef typename Alloc::template rebind<int>::other alloc_type;
+  for (std::size_t r = 0; r < rounds; ++r) {
+    ft::list<int, alloc_type> l;
+    for (int i = 0; i < 64; ++i)
+      l.push_back(i);
+    while (!l.empty())
+      l.pop_front();
+    ft::deque<int, alloc_type> d(256, static_cast<int>(r));
+  }
+}
+
+// Threads work in pairs: one allocates blocks and passes them over an
+// spsc_queue, the other frees them, so every block dies on a thread that
+// did not allocate it.
+template <typename Alloc>
+void cross_thread_handoff(std::size_t blocks) {
+  typedef typename Alloc::template rebind<long>::other alloc_type;
+  ft::spsc_queue<long*> queue(1024);
+  std::thread consumer([&queue, blocks]() {
+    alloc_type alloc;
+    long* p;
+    for (std::size_t done = 0; done < blocks;) {
+      if (!queue.try_pop(p)) {
+        std::this_thread::yield();
+        continue;
+      }
+      alloc.deallocate(p, 4);
+      ++done;
+    }
+  });
+  alloc_type alloc;
+  for (std::size_t i = 0; i < blocks; ++i) {
+    long* p = alloc.allocate(4);
+    while (!queue.try_push(p))
+      std::this_thread::yield();
+  }
+  consumer.join();
+}
+
+template <typename Alloc>
+double run_thread_cache_case(int function, std::size_t threads, std::size_t work) {
+  return measure_wall_time([&]() {
+    std::vector<std::thread> workers;
+    if (function == 0) {
+      for (std::size_t t = 0; t < threads; ++t)
+        workers.push_back(std::thread([work]() { container_churn<Alloc>(work); }));
+    } else {
+      for (std::size_t t = 0; t < (threads + 1) / 2; ++t)
+        workers.push_back(std::thread([work]() { cross_thread_handoff<Alloc>(work * 64); }));
+    }
+    for (std::size_t t = 0; t < workers.size(); ++t)
+      workers[t].join();
+  });
+}
+
+// Allocation throughput per thread count: a flat OpsPerSec/Threads ratio
+// means the allocator scales.
+inline void run_thread_cache_benchmark(std::size_t count, std::ofstream& out) {
+  static const char* functions[] = { "container_churn", "cross_thread_free" };
+  static const char* names[] = { "ft_thread_cache", "std" };
+  std::vector<std::size_t> thread_counts = thread_cache_thread_counts();
+  std::size_t rounds = count / 100 + 1;
+  std::size_t total = thread_counts.size() * 4;
+  std::size_t done = 0;
+
+  for (int f = 0; f < 2; ++f) {
+    for (std::size_t i = 0; i < thread_counts.size(); ++i) {
+      std::size_t threads = thread_counts[i];
+      for (int variant = 0; variant < 2; ++variant) {
+        std::ostringstream label;
+        label << names[variant] << " / " << threads << " threads / " << functions[f]
+              << " [thread_cache]";
+        print_progress(done++, total, label.str());
+        double time = variant == 0
+                          ? run_thread_cache_case<ft::thread_cache_allocator<int> >(f, threads, rounds)
+                          : run_thread_cache_case<std::allocator<int> >(f, threads, rounds);
+        // churn: 64 nodes and 4 deque blocks plus the map per round;
+        // handoff: one block per item, per producer/consumer pair
+        double ops = f == 0 ? double(threads) * rounds * (64 + 5)
+                            : double((threads + 1) / 2) * rounds * 64;
+        out << "int," << functions[f] << "," << count << "," << names[variant] << "," << time
+            << "," << threads << "," << (time > 0 ? ops / time : 0) << "\n";
+      }
+    }
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
@@ -0,0 +1,114 @@
+#include <thread>
+#include <sstream>
+#include "shared_utils.hpp"
+#include "vector.hpp"
+#include "concurrency/thread_pool.hpp"
+
+namespace benchmark {
+
+// Serial cut-off of the recursive fib workload.
+static const unsigned FIB_CUTOFF = 12;
+
+inline unsigned long fib_serial(unsigned n) {
+  return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+inline unsigned long fib_parallel(ft::thread_pool& pool, unsigned n) {
+  if (n < FIB_CUTOFF)
+    return fib_serial(n);
+  unsigned long a = 0, b = 0;
+  pool.parallel_invoke([&]() { a = fib_parallel(pool, n - 1); },
+                       [&]() { b = fib_parallel(pool, n - 2); });
+  return a + b;
+}
+
+// Binary fork tree with empty leaves: measures pure spawn/join overhead.
+inline void spawn_tree(ft::thread_pool& pool, std::size_t tasks) {
+  if (tasks <= 1)
+    return;
+  pool.parallel_invoke([&]() { spawn_tree(pool, tasks / 2); },
+                       [&]() { spawn_tree(pool, tasks - tasks / 2); });
+}
+
+inline long long sum_serial(const ft::vector<int>& v, std::size_t lo, std::size_t hi) {
+  long long s = 0;
+  for (std::size_t i = lo; i < hi; ++i)
+    s += v[i];
+  return s;
+}
+
+inline unsigned fib_input(std::size_t count) {
+  unsigned n = 8;
+  while (count > 1) {
+    count >>= 1;
+    ++n;
+  }
+  return n;
+}
+
+inline void run_thread_pool_benchmark(std::size_t count, std::ofstream& out) {
+  std::vector<int> data = generate_data<int>(count);
+  ft::vector<int> vec(data.begin(), data.end());
+  std::size_t max_threads = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t n = 1; n < max_threads; n *= 2)
+    thread_counts.push_back(n);
+  thread_counts.push_back(max_threads);
+
+  std::size_t total = 3 * (thread_counts.size() + 1);
+  std::size_t done = 0;
+  unsigned n = fib_input(count);
+  volatile unsigned long sink = 0;
+
+  struct Row {
+    static void write(std::ofstream& out, const char* fn, std::size_t count,
+                      const std::string& ns, double time) {
+      out << "int," << fn << "," << count << "," << ns << "," << time << "\n";
+    }
+  };
+
+  // Serial baselines
+  print_progress(done++, total, "serial / spawn_tree");
+  Row::write(out, "spawn_tree", count, "serial", measure_wall_time([&]() {
+    for (std::size_t i = 0; i < count; ++i)
+      sink = sink + i;
+  }));
+  print_progress(done++, total, "serial / fib");
+  Row::write(out, "fib", count, "serial", measure_wall_time([&]() { sink = fib_serial(n); }));
+  print_progress(done++, total, "serial / parallel_for_sum");
+  Row::write(out, "parallel_for_sum", count, "serial", measure_wall_time([&]() {
+    sink = sum_serial(vec, 0, vec.size());
+  }));
+
+  for (std::size_t t = 0; t < thread_counts.size(); ++t) {
+    ft::thread_pool pool(thread_counts[t]);
+    std::ostringstream ns;
+    ns << "ft_" << thread_counts[t] << "t";
+
+    print_progress(done++, total, ns.str() + " / spawn_tree");
+    Row::write(out, "spawn_tree", count, ns.str(), measure_wall_time([&]() {
+      spawn_tree(pool, count);
+    }));
+
+    print_progress(done++, total, ns.str() + " / fib");
+    Row::write(out, "fib", count, ns.str(), measure_wall_time([&]() {
+      unsigned long r = 0;
+      pool.run([&]() { r = fib_parallel(pool, n); });
+      if (r != fib_serial(n))
+        std::cerr << "\nthread_pool benchmark: wrong fib result" << std::endl;
+      sink = r;
+    }));
+
+    print_progress(done++, total, ns.str() + " / parallel_for_sum");
+    Row::write(out, "parallel_for_sum", count, ns.str(), measure_wall_time([&]() {
+      std::atomic<long long> sum(0);
+      pool.parallel_for(std::size_t(0), vec.size(), std::size_t(0),
+                        [&](std::size_t lo, std::size_t hi) { sum += sum_serial(vec, lo, hi); });
+      sink = sum.load();
+    }));
+  }
+  std::cout << "\r" << std::string(80, ' ') << "\r";
+}
+
+} // namespace benchmark
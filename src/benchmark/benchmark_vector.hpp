@@ -1,8 +1,10 @@
 #include "ContainerBenchmark.hpp"
 
-template <template<typename, typename> class VecType, typename T>
-void register_vector_tests(benchmark::ContainerBenchmark<VecType<T, std::allocator<T>>, T>& bench) {
-  typedef VecType<T, std::allocator<T>> Vec;
+// Variadic so it binds both std::vector and ft::vector (which adds a growth
+// policy parameter)
+template <template<typename...> class VecType, typename T>
+void register_vector_tests(benchmark::ContainerBenchmark<VecType<T>, T>& bench) {
+  typedef VecType<T> Vec;
 
   bench.add("default_ctor", [](Vec& v, const std::vector<T>&){ Vec tmp; });
 
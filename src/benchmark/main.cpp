@@ -1,13 +1,76 @@
 #include "ContainerBenchmark.hpp"
 #include "benchmark_vector.hpp"
 #include "benchmark_list.hpp"
+#include "benchmark_indexed_heap.hpp"
+#include "benchmark_ring_buffer.hpp"
+#include "benchmark_spsc_queue.hpp"
+#include "benchmark_mpmc_queue.hpp"
+#include "benchmark_thread_pool.hpp"
+#include "benchmark_parallel.hpp"
+#include "benchmark_sort.hpp"
+#include "benchmark_simd.hpp"
+#include "benchmark_filter.hpp"
+#include "benchmark_small_vector.hpp"
+#include "benchmark_growth.hpp"
+#include "benchmark_mmap.hpp"
+#include "benchmark_aligned.hpp"
+#include "benchmark_arena.hpp"
+#include "benchmark_thread_cache.hpp"
+#include "benchmark_contiguous.hpp"
+#include "benchmark_bitset.hpp"
+#include "benchmark_soa.hpp"
+#include "benchmark_packed.hpp"
+#include "benchmark_hive.hpp"
+#include "benchmark_slot_map.hpp"
 #include "Point.hpp"
 
 int main() {
   std::ofstream csv_vector("benchmark_vector.csv");
   std::ofstream csv_list("benchmark_list.csv");
+  std::ofstream csv_indexed_heap("benchmark_indexed_heap.csv");
+  std::ofstream csv_ring_buffer("benchmark_ring_buffer.csv");
+  std::ofstream csv_spsc_queue("benchmark_spsc_queue.csv");
+  std::ofstream csv_mpmc_queue("benchmark_mpmc_queue.csv");
+  std::ofstream csv_thread_pool("benchmark_thread_pool.csv");
+  std::ofstream csv_parallel("benchmark_parallel.csv");
+  std::ofstream csv_sort("benchmark_sort.csv");
+  std::ofstream csv_simd("benchmark_simd.csv");
+  std::ofstream csv_filter("benchmark_filter.csv");
+  std::ofstream csv_small_vector("benchmark_small_vector.csv");
+  std::ofstream csv_growth("benchmark_growth.csv");
+  std::ofstream csv_mmap("benchmark_mmap.csv");
+  std::ofstream csv_aligned("benchmark_aligned.csv");
+  std::ofstream csv_arena("benchmark_arena.csv");
+  std::ofstream csv_thread_cache("benchmark_thread_cache.csv");
+  std::ofstream csv_contiguous("benchmark_contiguous.csv");
+  std::ofstream csv_bitset("benchmark_bitset.csv");
+  std::ofstream csv_soa("benchmark_soa.csv");
+  std::ofstream csv_packed("benchmark_packed.csv");
+  std::ofstream csv_hive("benchmark_hive.csv");
+  std::ofstream csv_slot_map("benchmark_slot_map.csv");
   csv_vector << "Type,Function,Size,Namespace,Time\n";
   csv_list << "Type,Function,Size,Namespace,Time\n";
+  csv_indexed_heap << "Type,Function,Size,Namespace,Time\n";
+  csv_ring_buffer << "Type,Function,Size,Namespace,Time\n";
+  csv_spsc_queue << "Type,Function,Size,Namespace,Time\n";
+  csv_mpmc_queue << "Type,Function,Size,Namespace,Time,OpsPerSec,Retries\n";
+  csv_thread_pool << "Type,Function,Size,Namespace,Time\n";
+  csv_parallel << "Type,Function,Size,Namespace,Time,Speedup\n";
+  csv_sort << "Type,Function,Size,Namespace,Time\n";
+  csv_simd << "Type,Function,Size,Namespace,Time\n";
+  csv_filter << "Type,Function,Size,Namespace,Time\n";
+  csv_small_vector << "Type,Function,Size,Namespace,Time,Allocations\n";
+  csv_growth << "Type,Function,Size,Namespace,Time,Overhead,Allocations\n";
+  csv_mmap << "Type,Function,Size,Namespace,Time,DTLBMisses\n";
+  csv_aligned << "Type,Function,Size,Namespace,Time\n";
+  csv_arena << "Type,Function,Size,Namespace,Time\n";
+  csv_thread_cache << "Type,Function,Size,Namespace,Time,Threads,OpsPerSec\n";
+  csv_contiguous << "Type,Function,Size,Namespace,Time\n";
+  csv_bitset << "Type,Function,Size,Namespace,Time,Bytes\n";
+  csv_soa << "Type,Function,Size,Namespace,Time\n";
+  csv_packed << "Type,Function,Size,Namespace,Time,BytesPerElement\n";
+  csv_hive << "Type,Function,Size,Namespace,Time\n";
+  csv_slot_map << "Type,Function,Size,Namespace,Time\n";
 
   std::size_t sizes[] = {1000, 10000, 100000};
 
@@ -91,5 +154,151 @@ int main() {
       register_list_tests<std::list, Point>(bench);
       bench.run(size, csv_list);
     }
+
+    // - INDEXED HEAP -
+    // ---- INT ----
+    {
+      benchmark::ContainerBenchmark<ft::indexed_heap<int>, int> bench("ft", "int", "indexed_heap");
+      register_indexed_heap_tests(bench);
+      bench.run(size, csv_indexed_heap);
+    }
+
+    {
+      benchmark::ContainerBenchmark<benchmark::LazyHeap<int>, int> bench("lazy", "int", "indexed_heap");
+      register_indexed_heap_tests(bench);
+      bench.run(size, csv_indexed_heap);
+    }
+
+    // ---- POINT ----
+    {
+      benchmark::ContainerBenchmark<ft::indexed_heap<Point>, Point> bench("ft", "point", "indexed_heap");
+      register_indexed_heap_tests(bench);
+      bench.run(size, csv_indexed_heap);
+    }
+
+    {
+      benchmark::ContainerBenchmark<benchmark::LazyHeap<Point>, Point> bench("lazy", "point", "indexed_heap");
+      register_indexed_heap_tests(bench);
+      bench.run(size, csv_indexed_heap);
+    }
+
+    // - RING BUFFER -
+    // ---- INT ----
+    {
+      benchmark::ContainerBenchmark<benchmark::RingWindow<int>, int> bench("ft", "int", "ring_buffer");
+      register_ring_buffer_tests(bench);
+      bench.run(size, csv_ring_buffer);
+    }
+
+    {
+      benchmark::ContainerBenchmark<benchmark::DequeWindow<int>, int> bench("std", "int", "ring_buffer");
+      register_ring_buffer_tests(bench);
+      bench.run(size, csv_ring_buffer);
+    }
+
+    // ---- POINT ----
+    {
+      benchmark::ContainerBenchmark<benchmark::RingWindow<Point>, Point> bench("ft", "point", "ring_buffer");
+      register_ring_buffer_tests(bench);
+      bench.run(size, csv_ring_buffer);
+    }
+
+    {
+      benchmark::ContainerBenchmark<benchmark::DequeWindow<Point>, Point> bench("std", "point", "ring_buffer");
+      register_ring_buffer_tests(bench);
+      bench.run(size, csv_ring_buffer);
+    }
+
+    // - SPSC QUEUE -
+    // ---- INT ----
+    {
+      benchmark::ContainerBenchmark<benchmark::SpscChannel<int>, int> bench("ft", "int", "spsc_queue");
+      register_spsc_queue_tests(bench);
+      bench.run(size, csv_spsc_queue);
+    }
+
+    {
+      benchmark::ContainerBenchmark<benchmark::MutexChannel<int>, int> bench("mutex", "int", "spsc_queue");
+      register_spsc_queue_tests(bench);
+      bench.run(size, csv_spsc_queue);
+    }
+
+    // ---- POINT ----
+    {
+      benchmark::ContainerBenchmark<benchmark::SpscChannel<Point>, Point> bench("ft", "point", "spsc_queue");
+      register_spsc_queue_tests(bench);
+      bench.run(size, csv_spsc_queue);
+    }
+
+    {
+      benchmark::ContainerBenchmark<benchmark::MutexChannel<Point>, Point> bench("mutex", "point", "spsc_queue");
+      register_spsc_queue_tests(bench);
+      bench.run(size, csv_spsc_queue);
+    }
+
+    // - MPMC QUEUE -
+    benchmark::run_mpmc_queue_benchmark(size, csv_mpmc_queue);
+
+    // - THREAD POOL -
+    benchmark::run_thread_pool_benchmark(size, csv_thread_pool);
+
+    // - PARALLEL ALGORITHMS -
+    benchmark::run_parallel_benchmark(size, csv_parallel);
+
+    // - SORT -
+    benchmark::run_sort_benchmark(size, csv_sort);
+
+    // - SIMD SEARCH -
+    benchmark::run_simd_benchmark(size, csv_simd);
+
+    // - FILTER -
+    benchmark::run_filter_benchmark(size, csv_filter);
+
+    // - SMALL VECTOR -
+    benchmark::run_small_vector_benchmark(size, csv_small_vector);
+
+    // - GROWTH POLICY -
+    benchmark::run_growth_benchmark(size, csv_growth);
+
+    // - MMAP ALLOCATOR -
+    benchmark::run_mmap_benchmark(size, csv_mmap);
+
+    // - ALIGNED ALLOCATOR -
+    benchmark::run_aligned_benchmark(size, csv_aligned);
+
+    // - ARENA -
+    benchmark::run_arena_benchmark(size, csv_arena);
+
+    // - THREAD CACHE ALLOCATOR -
+    benchmark::run_thread_cache_benchmark(size, csv_thread_cache);
+
+    // - CONTIGUOUS ITERATORS -
+    benchmark::run_contiguous_benchmark(size, csv_contiguous);
+
+    // - DYNAMIC BITSET -
+    benchmark::run_bitset_benchmark(size, csv_bitset);
+
+    // - STRUCTURE OF ARRAYS -
+    benchmark::run_soa_benchmark(size, csv_soa);
+
+    // - PACKED INTEGERS -
+    benchmark::run_packed_benchmark(size, csv_packed);
+
+    // - HIVE -
+    benchmark::run_hive_benchmark(size, csv_hive);
+
+    // - SLOT MAP -
+    benchmark::run_slot_map_benchmark(size, csv_slot_map);
+  }
+
+  if (benchmark::large_runs_enabled()) {
+    std::size_t large_sizes[] = {10000000, 100000000};
+    for (std::size_t size : large_sizes) {
+      benchmark::run_parallel_benchmark(size, csv_parallel);
+      benchmark::run_radix_sort_benchmark(size, csv_sort);
+      benchmark::run_mmap_benchmark(size, csv_mmap);
+      benchmark::run_bitset_benchmark(size, csv_bitset);
+      benchmark::run_packed_benchmark(size, csv_packed);
+    }
   }
 }
@@ -9,6 +9,8 @@
 #include <ctime>
 #include <cstdlib>
 #include <iterator>
+#include <chrono>
+#include <memory>
 #include "Point.hpp"
 
 namespace benchmark {
@@ -65,10 +67,45 @@ double measure_time(Func f) {
   return static_cast<double>(end - start) / CLOCKS_PER_SEC;
 }
 
+// clock() sums CPU time over all threads, so multi-threaded cases are timed
+// on the wall clock instead.
+template <typename Func>
+double measure_wall_time(Func f) {
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  f();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+// std::allocator that counts calls to allocate, shared by every rebind
+inline std::size_t& allocation_count() {
+  static std::size_t count = 0;
+  return count;
+}
+
+template <typename T>
+struct CountingAllocator : std::allocator<T> {
+  template <typename U>
+  struct rebind { typedef CountingAllocator<U> other; };
+
+  CountingAllocator() {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(std::size_t n, const void* = 0) {
+    ++allocation_count();
+    return std::allocator<T>::allocate(n);
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
 } // namespace benchmark
 
 #include <iomanip>
-#include <chrono>
 
 inline void print_progress(std::size_t current, std::size_t total, const std::string& label) {
   static std::size_t last_len = 0;
@@ -0,0 +1,33 @@
+// main.cpp — tests for the C++11 concurrency headers, built with TSan
+
+#include <iostream>
+#include <string>
+
+void run_spsc_queue_tests();
+void run_mpmc_queue_tests();
+void run_ws_deque_tests();
+void run_thread_pool_tests();
+void run_parallel_algorithm_tests();
+void run_thread_cache_allocator_tests();
+
+void print_header(const std::string& container_name) {
+    std::cout << "\n==========================" << std::endl;
+    std::cout << "Testing: " << container_name << std::endl;
+    std::cout << "==========================\n" << std::endl;
+}
+
+int main() {
+    print_header("SPSC queue");
+    run_spsc_queue_tests();
+    print_header("MPMC queue");
+    run_mpmc_queue_tests();
+    print_header("Work-stealing deque");
+    run_ws_deque_tests();
+    print_header("Thread pool");
+    run_thread_pool_tests();
+    print_header("Parallel algorithms");
+    run_parallel_algorithm_tests();
+    print_header("Thread cache allocator");
+    run_thread_cache_allocator_tests();
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "concurrency/mpmc_queue.hpp"
+
+namespace {
+
+const int producers = 4;
+const int consumers = 3;
+const int per_producer = 20000;
+
+// Each value encodes its producer and that producer's sequence number
+int encode(int producer, int seq) { return producer * per_producer + seq; }
+
+}
+
+void run_mpmc_queue_tests() {
+    std::cout << "\n[ft::mpmc_queue] Starting tests..." << std::endl;
+    {
+        bool thrown = false;
+        try {
+            ft::mpmc_queue<int> q(1);
+        } catch (const ft::exception&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        ft::mpmc_queue<int> q(3);
+        assert(q.capacity() == 4);
+        for (int i = 0; i < 4; ++i)
+            assert(q.try_push(i));
+        assert(!q.try_push(4) && q.size_approx() == 4);
+        int out[8];
+        assert(q.try_pop_n(out, 8) == 4 && out[0] == 0 && out[3] == 3);
+        assert(!q.try_pop(out[0]) && q.size_approx() == 0);
+    }
+    {
+        // One batch pop that frees several slots wakes every parked producer
+        ft::mpmc_queue<int> q(4);
+        for (int i = 0; i < 4; ++i)
+            q.push(i);
+        std::atomic<int> done(0);
+        std::vector<std::thread> parked;
+        for (int p = 0; p < 3; ++p)
+            parked.push_back(std::thread([&q, &done, p]() {
+                q.push(10 + p);
+                ++done;
+            }));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        int out[4];
+        assert(q.try_pop_n(out, 4) == 4);
+        for (int wait = 0; wait < 200 && done < 3; ++wait)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        assert(done == 3);
+        for (std::size_t i = 0; i < parked.size(); ++i)
+            parked[i].join();
+        assert(q.size_approx() == 3);
+    }
+    {
+        // Producers mix blocking and non-blocking pushes into a small queue,
+        // so both sides park. Every value must be dequeued exactly once, and
+        // each consumer must see a given producer's values in order.
+        ft::mpmc_queue<int> q(16);
+        std::vector<std::vector<int> > received(consumers);
+        std::vector<std::thread> threads;
+        for (int c = 0; c < consumers; ++c) {
+            threads.push_back(std::thread([&q, &received, c]() {
+                int batch[4];
+                for (;;) {
+                    std::size_t got = c == 0 ? q.pop_n(batch, 4) : (q.pop(batch[0]), 1);
+                    for (std::size_t i = 0; i < got; ++i) {
+                        if (batch[i] < 0)
+                            return;
+                        received[c].push_back(batch[i]);
+                    }
+                }
+            }));
+        }
+        std::vector<std::thread> pushers;
+        for (int p = 0; p < producers; ++p) {
+            pushers.push_back(std::thread([&q, p]() {
+                for (int seq = 0; seq < per_producer; ++seq) {
+                    if (p % 2 == 0)
+                        q.push(encode(p, seq));
+                    else
+                        while (!q.try_push(encode(p, seq)))
+                            std::this_thread::yield();
+                }
+            }));
+        }
+        for (std::size_t i = 0; i < pushers.size(); ++i)
+            pushers[i].join();
+        // One stop marker per consumer, plus spares: consumer 0 may take up
+        // to four markers in a single pop_n batch.
+        for (int c = 0; c < consumers + 4; ++c)
+            q.push(-1);
+        for (std::size_t i = 0; i < threads.size(); ++i)
+            threads[i].join();
+
+        std::vector<int> seen(producers * per_producer, 0);
+        for (int c = 0; c < consumers; ++c) {
+            std::vector<int> last(producers, -1);
+            for (std::size_t i = 0; i < received[c].size(); ++i) {
+                int v = received[c][i];
+                int p = v / per_producer;
+                int seq = v % per_producer;
+                assert(seq > last[p]);
+                last[p] = seq;
+                ++seen[v];
+            }
+        }
+        for (std::size_t v = 0; v < seen.size(); ++v)
+            assert(seen[v] == 1);
+    }
+    std::cout << "[ft::mpmc_queue] All tests passed." << std::endl;
+}
@@ -0,0 +1,148 @@
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+#include "concurrency/parallel_algorithm.hpp"
+#include "../test_utils.hpp"
+
+namespace {
+
+// Counts live instances across threads; copies of poison throw once armed
+struct counted {
+    static std::atomic<int>  live;
+    static std::atomic<bool> armed;
+    static const int         poison = 7777;
+
+    int value;
+
+    counted(int v = 0) : value(v) { ++live; }
+    counted(const counted& other) : value(other.value) {
+        if (armed && value == poison)
+            throw 42;
+        ++live;
+    }
+    ~counted() { --live; }
+    counted& operator=(const counted& other) {
+        value = other.value;
+        return *this;
+    }
+    bool operator<(const counted& other) const { return value < other.value; }
+};
+
+std::atomic<int>  counted::live(0);
+std::atomic<bool> counted::armed(false);
+
+bool is_odd(int x) { return x % 2 != 0; }
+
+}
+
+void run_parallel_algorithm_tests() {
+    std::cout << "\n[ft parallel algorithms] Starting tests..." << std::endl;
+    ft::parallel_executor exec(4);
+    assert(exec.serial_threshold() == ft::parallel_executor::DEFAULT_SERIAL_THRESHOLD);
+
+    // Sizes around and well above the serial threshold
+    const std::size_t sizes[] = { 1000, 16385, 100000, 250001 };
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        std::size_t n = sizes[s];
+        unsigned int state = static_cast<unsigned int>(n);
+        std::vector<int> data(n);
+        for (std::size_t i = 0; i < n; ++i)
+            data[i] = static_cast<int>(test::next_random(state) % 100000) - 50000;
+
+        // sort, with the default and a custom comparison
+        ft::vector<int> v(data.begin(), data.end());
+        std::vector<int> expected(data);
+        std::sort(expected.begin(), expected.end());
+        ft::parallel_sort(exec, v.begin(), v.end());
+        assert(std::equal(v.begin(), v.end(), expected.begin()));
+        ft::parallel_sort(exec, v.begin(), v.end(), std::greater<int>());
+        assert(std::equal(v.rbegin(), v.rend(), expected.begin()));
+
+        // reduce
+        long long sum = std::accumulate(data.begin(), data.end(), 0LL);
+        assert(ft::parallel_reduce(exec, data.begin(), data.end(), 5LL) == sum + 5);
+        assert(ft::parallel_reduce(exec, data.begin(), data.end(), 0LL, std::plus<long long>()) == sum);
+
+        // transform and copy
+        std::vector<int> out(n);
+        std::vector<int> want(n);
+        std::transform(data.begin(), data.end(), want.begin(), std::negate<int>());
+        assert(ft::parallel_transform(exec, data.begin(), data.end(), out.begin(), std::negate<int>()) == out.end());
+        assert(out == want);
+        std::fill(out.begin(), out.end(), 0);
+        assert(ft::parallel_copy(exec, data.begin(), data.end(), out.begin()) == out.end());
+        assert(out == data);
+
+        // count_if and for_each
+        assert(ft::parallel_count_if(exec, data.begin(), data.end(), is_odd) ==
+               std::count_if(data.begin(), data.end(), is_odd));
+        ft::parallel_for_each(exec, out.begin(), out.end(), [](int& x) { x *= 2; });
+        for (std::size_t i = 0; i < n; ++i)
+            assert(out[i] == 2 * data[i]);
+    }
+    {
+        // A threshold of 1 still bottoms out in serial sorts and merges
+        ft::parallel_executor tiny(2, 1);
+        unsigned int state = 3;
+        for (std::size_t n = 0; n < 70; ++n) {
+            std::vector<int> data(n);
+            for (std::size_t i = 0; i < n; ++i)
+                data[i] = static_cast<int>(test::next_random(state) % (n / 2 + 1));
+            std::vector<int> expected(data);
+            std::sort(expected.begin(), expected.end());
+            ft::parallel_sort(tiny, data.begin(), data.end());
+            assert(data == expected);
+        }
+        exec.set_serial_threshold(1);
+        std::vector<int> data(5000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<int>(test::next_random(state) % 1000);
+        std::vector<int> expected(data);
+        std::sort(expected.begin(), expected.end());
+        ft::parallel_sort(exec, data.begin(), data.end());
+        assert(data == expected);
+        exec.set_serial_threshold(ft::parallel_executor::DEFAULT_SERIAL_THRESHOLD);
+    }
+    {
+        // A throwing copy or comparison releases the scratch buffer
+        std::vector<counted> v;
+        for (int i = 0; i < 100000; ++i)
+            v.push_back(counted(i * 7919 % 100000));
+        int live = counted::live;
+
+        counted::armed = true;
+        bool thrown = false;
+        try {
+            ft::parallel_sort(exec, v.begin(), v.end());
+        } catch (int) {
+            thrown = true;
+        }
+        counted::armed = false;
+        assert(thrown && counted::live == live);
+
+        std::atomic<int> budget(200000);
+        thrown = false;
+        try {
+            ft::parallel_sort(exec, v.begin(), v.end(), [&](const counted& a, const counted& b) {
+                if (--budget == 0)
+                    throw 42;
+                return a < b;
+            });
+        } catch (int) {
+            thrown = true;
+        }
+        assert(thrown && counted::live == live && v.size() == 100000);
+
+        // An interrupted merge leaves values unspecified, so start over
+        for (int i = 0; i < 100000; ++i)
+            v[i].value = i * 7919 % 100000;
+        ft::parallel_sort(exec, v.begin(), v.end());
+        for (int i = 0; i < 100000; ++i)
+            assert(v[i].value == i);
+    }
+    std::cout << "[ft parallel algorithms] All tests passed." << std::endl;
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include "concurrency/spsc_queue.hpp"
+
+void run_spsc_queue_tests() {
+    std::cout << "\n[ft::spsc_queue] Starting tests..." << std::endl;
+    {
+        // Capacity is rounded up to a power of two; full and empty at the edge
+        ft::spsc_queue<int> q(5);
+        assert(q.capacity() == 8 && q.empty());
+        int out = -1;
+        assert(!q.try_pop(out) && out == -1);
+        for (int i = 0; i < 8; ++i)
+            assert(q.try_push(i));
+        assert(!q.try_push(8) && q.size_approx() == 8);
+        for (int i = 0; i < 8; ++i)
+            assert(q.try_pop(out) && out == i);
+        assert(!q.try_pop(out) && q.empty());
+
+        // Batches wrap around the physical end and stop at capacity
+        int src[10] = { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+        int dst[10] = { 0 };
+        assert(q.try_push_n(src, 5) == 5);
+        assert(q.try_pop_n(dst, 3) == 3 && dst[0] == 10 && dst[2] == 12);
+        assert(q.try_push_n(src, 10) == 6 && q.size_approx() == 8);
+        assert(q.try_push_n(src, 1) == 0);
+        assert(q.try_pop_n(dst, 10) == 8);
+        assert(dst[0] == 13 && dst[1] == 14);
+        for (int i = 0; i < 6; ++i)
+            assert(dst[2 + i] == src[i]);
+        assert(q.try_pop_n(dst, 10) == 0 && q.empty());
+    }
+    {
+        // One producer, one consumer: every value arrives once, in order
+        const int count = 200000;
+        ft::spsc_queue<int> q(64);
+        std::thread producer([&]() {
+            int batch[7];
+            int next = 0;
+            while (next < count) {
+                std::size_t pushed;
+                if (next % 3 == 0) {
+                    int n = 0;
+                    for (; n < 7 && next + n < count; ++n)
+                        batch[n] = next + n;
+                    pushed = q.try_push_n(batch, n);
+                } else {
+                    pushed = q.try_push(next) ? 1 : 0;
+                }
+                if (pushed == 0)
+                    std::this_thread::yield();
+                next += static_cast<int>(pushed);
+            }
+        });
+        long long sum = 0;
+        int expected = 0;
+        std::vector<int> batch(5);
+        while (expected < count) {
+            assert(q.size_approx() <= q.capacity());
+            std::size_t got = q.try_pop_n(&batch[0], batch.size());
+            if (got == 0)
+                std::this_thread::yield();
+            for (std::size_t i = 0; i < got; ++i) {
+                assert(batch[i] == expected);
+                sum += batch[i];
+                ++expected;
+            }
+        }
+        producer.join();
+        assert(q.empty());
+        assert(sum == static_cast<long long>(count) * (count - 1) / 2);
+    }
+    std::cout << "[ft::spsc_queue] All tests passed." << std::endl;
+}
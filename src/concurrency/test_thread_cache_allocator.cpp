@@ -0,0 +1,106 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "vector.hpp"
+#include "list.hpp"
+#include "concurrency/spsc_queue.hpp"
+#include "memory/aligned_allocator.hpp"
+#include "memory/thread_cache_allocator.hpp"
+
+namespace {
+
+typedef ft::thread_cache_allocator<char> byte_allocator;
+
+bool aligned_to(const void* p, std::size_t align) {
+    return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+}
+
+// Size of the block handed over as number i
+std::size_t block_size(std::size_t i) { return 8 + (i * 37) % 3000; }
+
+}
+
+void run_thread_cache_allocator_tests() {
+    std::cout << "\n[ft::thread_cache_allocator] Starting tests..." << std::endl;
+    {
+        // Every size class, reused after a free, and the large path
+        byte_allocator alloc;
+        std::vector<char*> blocks;
+        for (std::size_t bytes = 1; bytes <= 8192; bytes = bytes * 2 + 1) {
+            char* p = alloc.allocate(bytes);
+            assert(aligned_to(p, 16));
+            std::memset(p, static_cast<int>(bytes & 0x7f), bytes);
+            blocks.push_back(p);
+        }
+        std::size_t bytes = 1;
+        for (std::size_t i = 0; i < blocks.size(); ++i, bytes = bytes * 2 + 1) {
+            assert(blocks[i][0] == static_cast<char>(bytes & 0x7f));
+            assert(blocks[i][bytes - 1] == static_cast<char>(bytes & 0x7f));
+            alloc.deallocate(blocks[i], bytes);
+        }
+        char* again = alloc.allocate(100);
+        alloc.deallocate(again, 100);
+        assert(alloc.allocate(100) == again);
+        alloc.deallocate(again, 100);
+    }
+    {
+        // Over-aligned types bypass the 16-byte aligned slabs
+        ft::thread_cache_allocator<ft::cache_padded<int> > padded;
+        for (std::size_t n = 1; n < 200; n += 37) {
+            ft::cache_padded<int>* p = padded.allocate(n);
+            assert(aligned_to(p, ft::cache_line_size));
+            padded.deallocate(p, n);
+        }
+        ft::vector<ft::cache_padded<int>, ft::thread_cache_allocator<ft::cache_padded<int> > > slots;
+        for (int i = 0; i < 100; ++i) {
+            slots.push_back(ft::cache_padded<int>(i));
+            assert(aligned_to(&slots[0], ft::cache_line_size));
+        }
+        assert(*slots[99] == 99);
+    }
+    {
+        // Blocks allocated on one thread are freed on another, long enough
+        // for whole batches to flow back through the depot
+        const std::size_t count = 50000;
+        ft::spsc_queue<char*> handoff(256);
+        std::thread consumer([&]() {
+            byte_allocator alloc;
+            for (std::size_t i = 0; i < count; ++i) {
+                char* p;
+                while (!handoff.try_pop(p))
+                    std::this_thread::yield();
+                std::size_t bytes = block_size(i);
+                assert(p[0] == static_cast<char>(i) && p[bytes - 1] == static_cast<char>(i));
+                alloc.deallocate(p, bytes);
+            }
+        });
+        byte_allocator alloc;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t bytes = block_size(i);
+            char* p = alloc.allocate(bytes);
+            std::memset(p, static_cast<int>(static_cast<char>(i)), bytes);
+            while (!handoff.try_push(p))
+                std::this_thread::yield();
+        }
+        consumer.join();
+
+        // Containers on several threads at once, each ending on its own
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; ++t) {
+            workers.push_back(std::thread([t]() {
+                for (int round = 0; round < 200; ++round) {
+                    ft::list<int, ft::thread_cache_allocator<int> > l;
+                    for (int i = 0; i < 64; ++i)
+                        l.push_back(t * 1000 + i);
+                    assert(l.size() == 64 && l.back() == t * 1000 + 63);
+                }
+            }));
+        }
+        for (std::size_t t = 0; t < workers.size(); ++t)
+            workers[t].join();
+    }
+    std::cout << "[ft::thread_cache_allocator] All tests passed." << std::endl;
+}
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <stdexcept>
+#include "concurrency/thread_pool.hpp"
+
+namespace {
+
+long fib(ft::thread_pool& pool, int n) {
+    if (n < 2)
+        return n;
+    if (n < 8)
+        return fib(pool, n - 1) + fib(pool, n - 2);
+    long a = 0;
+    long b = 0;
+    pool.parallel_invoke([&]() { a = fib(pool, n - 1); },
+                         [&]() { b = fib(pool, n - 2); });
+    return a + b;
+}
+
+}
+
+void run_thread_pool_tests() {
+    std::cout << "\n[ft::thread_pool] Starting tests..." << std::endl;
+    {
+        // Nested fork-join from an external thread and from inside the pool
+        ft::thread_pool pool(4);
+        assert(pool.size() == 4);
+        long result = 0;
+        pool.run([&]() { result = fib(pool, 22); });
+        assert(result == 17711);
+        assert(fib(pool, 18) == 2584);
+
+        // parallel_for covers every index exactly once
+        std::vector<int> hits(100000, 0);
+        pool.parallel_for(std::size_t(0), hits.size(), std::size_t(0),
+                          [&](std::size_t lo, std::size_t hi) {
+                              for (std::size_t i = lo; i < hi; ++i)
+                                  ++hits[i];
+                          });
+        for (std::size_t i = 0; i < hits.size(); ++i)
+            assert(hits[i] == 1);
+
+        // Several external threads fork into the same pool at once
+        std::vector<long> results(3, 0);
+        std::vector<std::thread> callers;
+        for (int c = 0; c < 3; ++c)
+            callers.push_back(std::thread([&pool, &results, c]() {
+                pool.run([&]() { results[c] = fib(pool, 16 + c); });
+            }));
+        for (std::size_t c = 0; c < callers.size(); ++c)
+            callers[c].join();
+        assert(results[0] == 987 && results[1] == 1597 && results[2] == 2584);
+
+        // An exception from either branch reaches the caller once both ran
+        std::atomic<int> ran(0);
+        bool thrown = false;
+        try {
+            pool.parallel_invoke([&]() { ++ran; },
+                                 [&]() { ++ran; throw std::runtime_error("right"); });
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && ran == 2);
+    }
+    {
+        // Pools shut down cleanly whether idle, parked or just used
+        for (int round = 0; round < 20; ++round) {
+            ft::thread_pool pool(1 + round % 4);
+            if (round % 2)
+                assert(fib(pool, 12) == 144);
+            if (round % 5 == 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+    std::cout << "[ft::thread_pool] All tests passed." << std::endl;
+}
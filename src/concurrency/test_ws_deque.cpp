@@ -0,0 +1,73 @@
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "concurrency/ws_deque.hpp"
+
+void run_ws_deque_tests() {
+    std::cout << "\n[ft::ws_deque] Starting tests..." << std::endl;
+    {
+        // Owner pops LIFO, thieves steal FIFO, and the ring grows when full
+        ft::ws_deque<int> d(2);
+        assert(d.empty());
+        for (int i = 1; i <= 5; ++i)
+            d.push(i);
+        assert(d.size_approx() == 5);
+        int x = 0;
+        assert(d.pop(x) && x == 5);
+        assert(d.steal(x) && x == 1);
+        assert(d.pop(x) && x == 4);
+        assert(d.steal(x) && x == 2);
+        assert(d.pop(x) && x == 3);
+        assert(!d.pop(x) && !d.steal(x) && d.empty());
+    }
+    {
+        // The owner pushes and pops while thieves steal; every value is
+        // taken exactly once.
+        const int count = 100000;
+        const int thieves = 3;
+        ft::ws_deque<int> d(4);
+        std::atomic<bool> finished(false);
+        std::vector<std::vector<int> > taken(thieves + 1);
+        std::vector<std::thread> threads;
+        for (int k = 0; k < thieves; ++k) {
+            threads.push_back(std::thread([&d, &finished, &taken, k]() {
+                int x;
+                for (;;) {
+                    if (d.steal(x))
+                        taken[k].push_back(x);
+                    else if (finished.load(std::memory_order_acquire))
+                        return;
+                    else
+                        std::this_thread::yield();
+                }
+            }));
+        }
+        std::vector<int>& mine = taken[thieves];
+        int x;
+        for (int i = 0; i < count; ++i) {
+            d.push(i);
+            if (i % 3 == 0 && d.pop(x))
+                mine.push_back(x);
+        }
+        while (d.pop(x))
+            mine.push_back(x);
+        finished.store(true, std::memory_order_release);
+        for (std::size_t k = 0; k < threads.size(); ++k)
+            threads[k].join();
+
+        std::vector<int> seen(count, 0);
+        for (std::size_t k = 0; k < taken.size(); ++k) {
+            // Steals come off the top, so each thief sees increasing values
+            for (std::size_t i = 0; i < taken[k].size(); ++i) {
+                if (k < static_cast<std::size_t>(thieves) && i > 0)
+                    assert(taken[k][i - 1] < taken[k][i]);
+                ++seen[taken[k][i]];
+            }
+        }
+        for (int i = 0; i < count; ++i)
+            assert(seen[i] == 1);
+    }
+    std::cout << "[ft::ws_deque] All tests passed." << std::endl;
+}
@@ -7,6 +7,28 @@
 
 void run_vector_compliance_tests();
 void run_list_compliance_tests();
+void run_algorithm_compliance_tests();
+void run_search_compliance_tests();
+void run_copy_compliance_tests();
+#ifdef MODE_FT
+void run_indexed_heap_tests();
+void run_ring_buffer_tests();
+void run_radix_sort_tests();
+void run_vector_filter_tests();
+void run_small_vector_tests();
+void run_static_vector_tests();
+void run_vector_growth_tests();
+void run_mmap_allocator_tests();
+void run_aligned_allocator_tests();
+void run_monotonic_arena_tests();
+void run_uninitialized_tests();
+void run_range_construction_tests();
+void run_dynamic_bitset_tests();
+void run_soa_vector_tests();
+void run_packed_vector_tests();
+void run_hive_tests();
+void run_slot_map_tests();
+#endif
 
 void print_header(const std::string& container_name) {
     std::cout << "\n==========================" << std::endl;
@@ -19,6 +41,48 @@ int main() {
     run_vector_compliance_tests();
     print_header("List");
     run_list_compliance_tests();
+    print_header("Sort");
+    run_algorithm_compliance_tests();
+    print_header("Search");
+    run_search_compliance_tests();
+    print_header("Copy");
+    run_copy_compliance_tests();
+#ifdef MODE_FT
+    print_header("Indexed heap");
+    run_indexed_heap_tests();
+    print_header("Ring buffer");
+    run_ring_buffer_tests();
+    print_header("Radix sort");
+    run_radix_sort_tests();
+    print_header("Vector filters");
+    run_vector_filter_tests();
+    print_header("Small vector");
+    run_small_vector_tests();
+    print_header("Static vector");
+    run_static_vector_tests();
+    print_header("Vector growth");
+    run_vector_growth_tests();
+    print_header("mmap allocator");
+    run_mmap_allocator_tests();
+    print_header("Aligned allocator");
+    run_aligned_allocator_tests();
+    print_header("Monotonic arena");
+    run_monotonic_arena_tests();
+    print_header("Uninitialized memory");
+    run_uninitialized_tests();
+    print_header("Range construction");
+    run_range_construction_tests();
+    print_header("Dynamic bitset");
+    run_dynamic_bitset_tests();
+    print_header("SoA vector");
+    run_soa_vector_tests();
+    print_header("Packed vector");
+    run_packed_vector_tests();
+    print_header("Hive");
+    run_hive_tests();
+    print_header("Slot map");
+    run_slot_map_tests();
+#endif
 
 {
     ft::deque<int> dq;
@@ -0,0 +1,19 @@
+// Compile-time checks of the hive slot layout. Only compiled, never run:
+// see `make static_checks`.
+
+#include "utils/hive_group.hpp"
+
+namespace {
+
+struct alignas(64) padded {
+    int value;
+};
+
+}
+
+// A slot holds either a T or the free list links, aligned for both
+static_assert(alignof(ft::hive_group<padded>::slot) == 64, "over-aligned element");
+static_assert(sizeof(ft::hive_group<padded>::slot) == sizeof(padded), "no padding past T");
+static_assert(alignof(ft::hive_group<char>::slot) ==
+              alignof(ft::hive_group<char>::free_links), "links set the alignment of small T");
+static_assert(sizeof(ft::hive_group<double>::slot) == sizeof(double), "double");
@@ -0,0 +1,52 @@
+// Compile-time checks for ft::static_vector's C++14 literal storage and
+// its layout guarantees. Only compiled, never run: see `make static_checks`.
+
+#include <string>
+#include <type_traits>
+#include "static_vector.hpp"
+#include "../benchmark/Point.hpp"
+
+namespace {
+
+constexpr int sum_after_edits() {
+    ft::static_vector<int, 8> v;
+    for (int i = 1; i <= 6; ++i)
+        v.push_back(i);
+    v.pop_back();
+    v[0] = 10;
+    int sum = 0;
+    for (std::size_t i = 0; i < v.size(); ++i)
+        sum += v.at(i);
+    return sum + static_cast<int>(v.capacity()) + (v.full() ? 1000 : 0);
+}
+
+constexpr bool clear_empties() {
+    ft::static_vector<char, 4> v;
+    v.push_back('a');
+    v.push_back('b');
+    bool before = !v.empty() && v.front() == 'a' && v.back() == 'b';
+    v.clear();
+    return before && v.empty() && v.size() == 0;
+}
+
+struct alignas(64) padded {
+    int value;
+};
+
+}
+
+// Literal storage: usable in constant expressions
+static_assert(sum_after_edits() == 10 + 2 + 3 + 4 + 5 + 8, "constexpr push_back, pop_back and access");
+static_assert(clear_empties(), "constexpr clear");
+constexpr ft::static_vector<int, 4> empty_ints;
+static_assert(empty_ints.empty() && empty_ints.max_size() == 4, "constexpr default construction");
+
+// The container is as copyable as its elements
+static_assert(std::is_trivially_copyable<ft::static_vector<int, 16> >::value, "int");
+static_assert(std::is_trivially_copyable<ft::static_vector<Point, 16> >::value, "Point");
+static_assert(!std::is_trivially_copyable<ft::static_vector<std::string, 16> >::value, "std::string");
+
+// Slots are aligned for T, including over-aligned T
+static_assert(alignof(ft::static_vector<double, 3>) >= alignof(double), "double");
+static_assert(alignof(ft::static_vector<padded, 3>) == 64, "over-aligned element");
+static_assert(sizeof(ft::static_vector<padded, 3>) >= 3 * sizeof(padded), "slot size");
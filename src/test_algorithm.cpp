@@ -0,0 +1,294 @@
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#ifdef MODE_FT
+    #include "vector.hpp"
+    #include "algorithm.hpp"
+    #include "test_utils.hpp"
+    namespace ns = ft;
+#else
+    #include <vector>
+    #include <algorithm>
+    namespace ns = std;
+#endif
+
+namespace {
+
+struct Keyed {
+    int key;
+    int order;
+    Keyed(int k = 0, int o = 0) : key(k), order(o) {}
+};
+
+struct KeyLess {
+    bool operator()(const Keyed& a, const Keyed& b) const { return a.key < b.key; }
+};
+
+template <typename Vec, typename Compare>
+bool is_sorted_by(const Vec& v, Compare comp) {
+    for (std::size_t i = 1; i < v.size(); ++i)
+        if (comp(v[i], v[i - 1]))
+            return false;
+    return true;
+}
+
+long long checksum(const ns::vector<int>& v) {
+    long long sum = 0;
+    for (std::size_t i = 0; i < v.size(); ++i)
+        sum += static_cast<long long>(v[i]) * (v[i] % 7 + 1);
+    return sum;
+}
+
+// Input shapes that exercise the pattern-defeating paths
+void fill_shape(ns::vector<int>& v, int shape, std::size_t n) {
+    v.clear();
+    std::srand(static_cast<unsigned>(shape * 7919 + n));
+    for (std::size_t i = 0; i < n; ++i) {
+        int x = 0;
+        switch (shape) {
+            case 0: x = std::rand(); break;                                  // random
+            case 1: x = static_cast<int>(i); break;                          // sorted
+            case 2: x = static_cast<int>(n - i); break;                      // reversed
+            case 3: x = std::rand() % 4; break;                              // few unique
+            case 4: x = static_cast<int>(i % 2 ? n - i : i); break;          // organ pipe
+            case 5: x = i + 1 == n ? -1 : static_cast<int>(i); break;        // sorted, then min
+            case 6: x = static_cast<int>(i % 16); break;                     // sawtooth
+        }
+        v.push_back(x);
+    }
+}
+
+}
+
+void run_algorithm_compliance_tests() {
+    std::cout << "\n[ns::sort] Starting API compliance tests..." << std::endl;
+
+    // Every 0/1 input up to 10 elements: covers the sorting networks and the
+    // insertion sort threshold
+    for (int n = 0; n <= 10; ++n) {
+        for (int mask = 0; mask < (1 << n); ++mask) {
+            int arr[10];
+            int ones = 0;
+            for (int i = 0; i < n; ++i) {
+                arr[i] = (mask >> i) & 1;
+                ones += arr[i];
+            }
+            ns::sort(arr, arr + n);
+            for (int i = 0; i < n; ++i)
+                assert(arr[i] == (i >= n - ones));
+        }
+    }
+
+    const std::size_t sizes[] = { 0, 1, 7, 23, 24, 129, 1000, 20000 };
+    for (int shape = 0; shape < 7; ++shape) {
+        for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            ns::vector<int> v;
+            fill_shape(v, shape, sizes[s]);
+            long long sum = checksum(v);
+
+            ns::sort(v.begin(), v.end());
+            assert(v.size() == sizes[s]);
+            assert(is_sorted_by(v, std::less<int>()));
+            assert(checksum(v) == sum);
+
+            fill_shape(v, shape, sizes[s]);
+            ns::sort(v.begin(), v.end(), std::greater<int>());
+            assert(is_sorted_by(v, std::greater<int>()));
+
+            fill_shape(v, shape, sizes[s]);
+            ns::stable_sort(v.begin(), v.end());
+            assert(is_sorted_by(v, std::less<int>()));
+            assert(checksum(v) == sum);
+        }
+    }
+
+    // Non-arithmetic elements take the branching partition
+    ns::vector<std::string> words;
+    for (int i = 0; i < 500; ++i)
+        words.push_back(std::string(1, static_cast<char>('a' + std::rand() % 26)) + "_" +
+                        std::string(1, static_cast<char>('a' + i % 26)));
+    ns::vector<std::string> copy(words);
+    ns::sort(words.begin(), words.end());
+    assert(is_sorted_by(words, std::less<std::string>()));
+    ns::stable_sort(copy.begin(), copy.end());
+    assert(copy == words);
+
+    // Stability with duplicate keys, including a strictly descending prefix
+    ns::vector<Keyed> keyed;
+    for (int i = 0; i < 40; ++i)
+        keyed.push_back(Keyed(40 - i, i));
+    for (int i = 0; i < 3000; ++i)
+        keyed.push_back(Keyed(std::rand() % 50, 40 + i));
+    ns::stable_sort(keyed.begin(), keyed.end(), KeyLess());
+    for (std::size_t i = 1; i < keyed.size(); ++i) {
+        assert(keyed[i - 1].key <= keyed[i].key);
+        if (keyed[i - 1].key == keyed[i].key)
+            assert(keyed[i - 1].order < keyed[i].order);
+    }
+
+    std::cout << "[ns::sort] All API compliance tests passed.\n" << std::endl;
+}
+
+namespace {
+
+void check_search() {
+    // Lengths around the 16 and 32 byte vector widths, from an odd offset
+    for (int n = 0; n < 80; ++n) {
+        ns::vector<int> ints;
+        ns::vector<char> chars;
+        ns::vector<double> reals;
+        for (int i = 0; i < n; ++i) {
+            ints.push_back((i * 37) % 11 - 5);
+            chars.push_back(static_cast<char>('a' + i % 7));
+            reals.push_back(i * 0.5);
+        }
+
+        for (int k = 0; k <= n; ++k) {
+            int target = k < n ? ints[k] : 100;
+            ns::vector<int>::iterator it = ns::find(ints.begin() + (n > 0), ints.end(), target);
+            int expected = n;
+            for (int i = n > 0; i < n; ++i)
+                if (ints[i] == target) {
+                    expected = i;
+                    break;
+                }
+            assert(it - ints.begin() == expected);
+        }
+
+        assert(ns::count(chars.begin(), chars.end(), 'c') == (n + 4) / 7);
+        assert(ns::count(reals.begin(), reals.end(), 2.5) == (n > 5));
+        assert(ns::find(reals.begin(), reals.end(), -1.0) == reals.end());
+
+        if (n > 0) {
+            int hi = ints[0];
+            int lo = ints[0];
+            std::size_t first_hi = 0;
+            for (int i = 1; i < n; ++i) {
+                if (ints[i] > hi) {
+                    hi = ints[i];
+                    first_hi = i;
+                }
+                lo = ints[i] < lo ? ints[i] : lo;
+            }
+            assert(*ns::min_element(ints.begin(), ints.end()) == lo);
+            assert(static_cast<std::size_t>(ns::max_element(ints.begin(), ints.end()) - ints.begin()) == first_hi);
+            assert(*ns::min_element(ints.begin(), ints.end(), std::greater<int>()) == hi);
+        }
+        assert(ns::max_element(ints.begin(), ints.begin()) == ints.begin());
+
+        ns::vector<int> other(ints);
+        assert(ns::equal(ints.begin(), ints.end(), other.begin()));
+        assert(ints == other && !(ints < other));
+        if (n > 0) {
+            other[n - 1] += 1;
+            assert(ns::mismatch(ints.begin(), ints.end(), other.begin()).first == ints.end() - 1);
+            assert(!ns::equal(ints.begin(), ints.end(), other.begin()));
+            assert(ints != other && ints < other);
+        }
+    }
+
+    // Unsigned and signed elements order differently past the first byte
+    ns::vector<unsigned int> u;
+    ns::vector<unsigned int> w;
+    u.push_back(1);
+    u.push_back(0x80000000u);
+    w.push_back(1);
+    w.push_back(2);
+    assert(w < u && !(u < w));
+    assert(*ns::max_element(u.begin(), u.end()) == 0x80000000u);
+
+    // Comparison works on values, not bit patterns
+    ns::vector<double> z;
+    ns::vector<double> nz;
+    z.push_back(0.0);
+    nz.push_back(-0.0);
+    assert(z == nz);
+    assert(ns::count(z.begin(), z.end(), -0.0) == 1);
+
+    ns::vector<std::string> words;
+    words.push_back("find");
+    words.push_back("count");
+    assert(ns::find(words.begin(), words.end(), std::string("count")) == words.begin() + 1);
+}
+
+}
+
+void run_search_compliance_tests() {
+    std::cout << "\n[ns::find] Starting API compliance tests..." << std::endl;
+
+    // The ft versions dispatch on the SIMD level, so run every kernel
+#ifdef MODE_FT
+    test::for_each_simd_level(check_search);
+#else
+    check_search();
+#endif
+
+    std::cout << "[ns::find] All API compliance tests passed.\n" << std::endl;
+}
+
+void run_copy_compliance_tests() {
+    std::cout << "\n[ns::copy] Starting API compliance tests..." << std::endl;
+
+    for (int n = 0; n < 40; ++n) {
+        ns::vector<int> src;
+        for (int i = 0; i < n; ++i)
+            src.push_back(i * 3 - 7);
+
+        ns::vector<int> dst(n + 2, 0);
+        ns::vector<int>::iterator end = ns::copy(src.begin(), src.end(), dst.begin() + 1);
+        assert(end == dst.begin() + 1 + n);
+        assert(dst[0] == 0 && dst[n + 1] == 0);
+        assert(ns::equal(src.begin(), src.end(), dst.begin() + 1));
+
+        // Overlapping shift right by one, as vector::insert does
+        ns::vector<int>::iterator first = ns::copy_backward(dst.begin(), dst.end() - 1, dst.end());
+        assert(first == dst.begin() + 1);
+        for (int i = 0; i < n; ++i)
+            assert(dst[i + 2] == src[i]);
+
+        // Reversed copy into a const source's mirror image
+        const ns::vector<int>& csrc = src;
+        ns::vector<int> rev(n, 0);
+        ns::vector<int>::reverse_iterator rend = ns::copy(csrc.begin(), csrc.end(), rev.rbegin());
+        assert(rend == rev.rend());
+        for (int i = 0; i < n; ++i)
+            assert(rev[n - 1 - i] == src[i]);
+
+        ns::fill(dst.begin(), dst.end(), 5);
+        assert(ns::count(dst.begin(), dst.end(), 5) == n + 2);
+
+        ns::vector<char> bytes(n, 'x');
+        ns::fill(bytes.rbegin(), bytes.rend(), 'y');
+        assert(ns::count(bytes.begin(), bytes.end(), 'y') == n);
+
+        ns::vector<int> longer(src);
+        longer.push_back(0);
+        assert(ns::lexicographical_compare(src.begin(), src.end(), longer.begin(), longer.end()));
+        assert(!ns::lexicographical_compare(longer.begin(), longer.end(), src.begin(), src.end()));
+        assert(!ns::lexicographical_compare(src.begin(), src.end(), csrc.begin(), csrc.end()));
+        if (n > 0) {
+            assert(ns::lexicographical_compare(rev.rbegin(), rev.rend(), longer.begin(), longer.end()));
+            longer[n / 2] -= 1;
+            assert(ns::lexicographical_compare(longer.begin(), longer.end(), src.begin(), src.end()));
+            assert(ns::lexicographical_compare(src.begin(), src.end(), longer.begin(), longer.end(),
+                                               std::greater<int>()));
+        }
+    }
+
+    // Mixed element types go through the generic path
+    ns::vector<long> wide(3, 9);
+    ns::vector<int> narrow(3, 0);
+    ns::copy(wide.begin(), wide.end(), narrow.begin());
+    assert(narrow[0] == 9 && narrow[2] == 9);
+    assert(ns::lexicographical_compare(narrow.begin(), narrow.end() - 1, wide.begin(), wide.end()));
+
+    ns::vector<std::string> words(2, "copy");
+    ns::vector<std::string> out(3);
+    ns::copy(words.begin(), words.end(), out.begin() + 1);
+    assert(out[0].empty() && out[1] == "copy" && out[2] == "copy");
+    assert(ns::lexicographical_compare(out.begin(), out.end(), words.begin(), words.end()));
+
+    std::cout << "[ns::copy] All API compliance tests passed.\n" << std::endl;
+}
@@ -0,0 +1,64 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <cstddef>
+#include "vector.hpp"
+#include "list.hpp"
+#include "deque.hpp"
+#include "algorithm.hpp"
+#include "memory/aligned_allocator.hpp"
+
+namespace {
+
+bool aligned_to(const void* p, std::size_t align) {
+    return reinterpret_cast<std::size_t>(p) % align == 0;
+}
+
+}
+
+void run_aligned_allocator_tests() {
+    std::cout << "\n[ft::aligned_allocator] Starting tests..." << std::endl;
+
+    // Every buffer the vector moves to stays aligned
+    ft::vector<int, ft::aligned_allocator<int, 32> > v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+        assert(aligned_to(&v[0], 32));
+    }
+    v.resize(3);
+    v.shrink_to_fit();
+    assert(aligned_to(&v[0], 32) && v[2] == 2);
+    assert(ft::find(v.begin(), v.end(), 2) == v.begin() + 2);
+
+    ft::vector<char, ft::aligned_allocator<char, 4096> > page(10, 'x');
+    assert(aligned_to(&page[0], 4096) && page[9] == 'x');
+
+    ft::vector<std::string, ft::aligned_allocator<std::string> > words(5, "aligned");
+    words.push_back("tail");
+    assert(aligned_to(&words[0], 64) && words[0] == "aligned" && words[5] == "tail");
+
+    // Deque blocks and list nodes come from the rebound allocator
+    ft::deque<double, ft::aligned_allocator<double> > dq(200, 1.5);
+    for (std::size_t i = 0; i < dq.size(); i += 64)
+        assert(aligned_to(&dq[i], 64) && dq[i] == 1.5);
+
+    ft::list<int, ft::aligned_allocator<int> > nodes;
+    for (int i = 0; i < 10; ++i)
+        nodes.push_back(i);
+    for (ft::list<int, ft::aligned_allocator<int> >::iterator it = nodes.begin(); it != nodes.end(); ++it)
+        assert(aligned_to(&*it, 64));
+
+    // Padding mode: one cache line per slot
+    typedef ft::cache_padded<long> slot;
+    ft::vector<slot, ft::aligned_allocator<slot> > slots(4);
+    assert(sizeof(slot) % ft::cache_line_size == 0);
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        assert(aligned_to(&*slots[i], ft::cache_line_size) && *slots[i] == 0);
+        *slots[i] += static_cast<long>(i);
+    }
+    assert(slots[3].value == 3);
+
+    std::cout << "[ft::aligned_allocator] All tests passed." << std::endl;
+}
+#endif
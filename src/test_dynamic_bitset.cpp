@@ -0,0 +1,131 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <algorithm>
+#include "dynamic_bitset.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+typedef ft::dynamic_bitset<> bitset;
+
+// Reference model: one bool per bit
+bool matches(const bitset& b, const std::vector<bool>& model) {
+    return test::same_indexed(b, model)
+        && b.count() == static_cast<std::size_t>(std::count(model.begin(), model.end(), true));
+}
+
+std::vector<bool> pattern(std::size_t n, std::size_t stride, std::size_t offset) {
+    std::vector<bool> bits(n);
+    for (std::size_t i = offset; i < n; i += stride)
+        bits[i] = true;
+    return bits;
+}
+
+bitset from(const std::vector<bool>& bits) {
+    bitset b;
+    for (std::size_t i = 0; i < bits.size(); ++i)
+        b.push_back(bits[i]);
+    return b;
+}
+
+// Sizes around block and vector widths
+void check_kernels() {
+    for (std::size_t n = 0; n < 700; n += (n < 140 ? 1 : 61)) {
+        std::vector<bool> a = pattern(n, 3, 1);
+        std::vector<bool> b = pattern(n, 5, 0);
+        bitset x = from(a);
+        bitset y = from(b);
+        assert(matches(x, a) && matches(y, b));
+
+        std::vector<bool> both(n), either(n), one(n), only(n), inverse(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            both[i] = a[i] && b[i];
+            either[i] = a[i] || b[i];
+            one[i] = a[i] != b[i];
+            only[i] = a[i] && !b[i];
+            inverse[i] = !a[i];
+        }
+        assert(matches(x & y, both));
+        assert(matches(x | y, either));
+        assert(matches(x ^ y, one));
+        assert(matches(x - y, only));
+        assert(matches(~x, inverse));
+        assert((~~x) == x);
+
+        // Walking the set bits visits exactly the model's ones
+        std::size_t pos = x.find_first();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (a[i]) {
+                assert(pos == i);
+                pos = x.find_next(pos);
+            }
+        }
+        assert(pos == bitset::npos);
+    }
+
+    // A lone bit far into a long zero run
+    bitset sparse(5000);
+    assert(sparse.none() && sparse.find_first() == bitset::npos);
+    sparse.set(4321);
+    assert(sparse.find_first() == 4321 && sparse.find_next(4321) == bitset::npos);
+    assert(sparse.find_next(0) == 4321 && sparse.count() == 1);
+}
+
+}
+
+void run_dynamic_bitset_tests() {
+    std::cout << "\n[ft::dynamic_bitset] Starting tests..." << std::endl;
+    {
+        bitset b(70, true);
+        assert(b.size() == 70 && b.num_blocks() == 2 && b.count() == 70 && b.all());
+        b.resize(130, true);
+        assert(b.count() == 130 && b.num_blocks() == 3);
+        b.resize(10);
+        assert(b.count() == 10 && b.num_blocks() == 1);
+        b.resize(66);
+        assert(b.count() == 10 && !b[65]);
+        b.flip();
+        assert(b.count() == 56 && b.find_first() == 10);
+        b.reset().set(3).flip(64);
+        assert(b.count() == 2 && b.test(3) && b.test(64) && !b.test(4));
+        b.set();
+        assert(b.all() && b.count() == 66);
+        while (b.size() > 63)
+            b.pop_back();
+        assert(b.num_blocks() == 1 && b.count() == 63);
+    }
+    {
+        // Proxy references
+        bitset b(8);
+        b[1] = true;
+        b[2] = b[1];
+        b[3].flip();
+        assert(b[2] && b[3] && !~b[1] && ~b[0]);
+        const bitset& cb = b;
+        assert(cb[1] && !cb[0] && cb.count() == 3);
+
+        bool thrown = false;
+        try {
+            b.test(8);
+        } catch (const ft::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    {
+        // Mismatched sizes: the shorter operand is zero-extended
+        bitset longer(200, true);
+        bitset shorter(70, true);
+        assert((longer & shorter).count() == 70);
+        assert((longer - shorter).count() == 130);
+        assert((shorter | longer).count() == 70);
+        bitset swapped(3, true);
+        swapped.swap(shorter);
+        assert(swapped.size() == 70 && shorter.size() == 3 && shorter != swapped);
+    }
+    test::for_each_simd_level(check_kernels);
+    std::cout << "[ft::dynamic_bitset] All tests passed." << std::endl;
+}
+#endif
@@ -0,0 +1,155 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <algorithm>
+#include "hive.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+using test::Tracked;
+
+// Same multiset of values, and the same order walked either way
+bool matches(const ft::hive<Tracked>& h, const std::vector<int>& model) {
+    if (h.size() != model.size() || !test::same_elements(h, model))
+        return false;
+    std::vector<Tracked> backward(h.rbegin(), h.rend());
+    std::reverse(backward.begin(), backward.end());
+    return test::same_sequence(h, backward);
+}
+
+}
+
+void run_hive_tests() {
+    std::cout << "\n[ft::hive] Starting tests..." << std::endl;
+    {
+        ft::hive<Tracked> h;
+        assert(h.empty() && h.begin() == h.end() && h.capacity() == 0);
+        for (int i = 0; i < 100; ++i)
+            h.insert(Tracked(i));
+        assert(h.size() == 100 && Tracked::live == 100);
+        // 8 + 16 + 32 + 64 slots
+        assert(h.capacity() == 120);
+        int expected = 0;
+        for (ft::hive<Tracked>::iterator it = h.begin(); it != h.end(); ++it)
+            assert(it->value == expected++);
+    }
+    assert(Tracked::live == 0);
+    {
+        // Erasing every other element, then runs: addresses stay put and
+        // iteration skips the holes in both directions
+        ft::hive<Tracked> h;
+        std::vector<Tracked*> addresses;
+        std::vector<int> model;
+        for (int i = 0; i < 300; ++i) {
+            addresses.push_back(&*h.insert(Tracked(i)));
+            model.push_back(i);
+        }
+        for (int i = 0; i < 300; i += 2)
+            h.erase(h.get_iterator(addresses[i]));
+        model.clear();
+        for (int i = 1; i < 300; i += 2)
+            model.push_back(i);
+        assert(matches(h, model));
+        for (int i = 1; i < 300; i += 2)
+            assert(addresses[i]->value == i);
+        for (int i = 101; i < 200; i += 2)
+            h.erase(h.get_iterator(addresses[i]));
+        model.clear();
+        for (int i = 1; i < 300; i += 2)
+            if (i < 101 || i > 199)
+                model.push_back(i);
+        assert(matches(h, model));
+        assert(Tracked::live == static_cast<int>(model.size()));
+
+        // Refills erased slots before growing
+        std::size_t capacity = h.capacity();
+        for (int i = 0; i < 150; ++i) {
+            h.insert(Tracked(1000 + i));
+            model.push_back(1000 + i);
+        }
+        assert(h.capacity() == capacity);
+        assert(matches(h, model));
+    }
+    assert(Tracked::live == 0);
+    {
+        // erase returns the next element in iteration order
+        ft::hive<Tracked> h;
+        for (int i = 0; i < 20; ++i)
+            h.insert(Tracked(i));
+        ft::hive<Tracked>::iterator it = h.begin();
+        std::advance(it, 5);
+        it = h.erase(it);
+        assert(it->value == 6);
+        it = h.erase(h.get_iterator(&*it));
+        assert(it->value == 7);
+        ft::hive<Tracked>::iterator first = h.begin();
+        std::advance(first, 2);
+        ft::hive<Tracked>::iterator last = first;
+        std::advance(last, 10);
+        int after = last->value;
+        it = h.erase(first, last);
+        assert(it->value == after && h.size() == 8);
+        it = h.erase(h.begin(), h.end());
+        assert(it == h.end() && h.empty() && h.capacity() == 0);
+        assert(Tracked::live == 0);
+        h.insert(Tracked(42));
+        assert(h.size() == 1 && h.begin()->value == 42);
+    }
+    assert(Tracked::live == 0);
+    {
+        // Random mix against a model, with groups emptied and freed
+        ft::hive<Tracked> h;
+        std::vector<int> model;
+        std::vector<Tracked*> live;
+        unsigned int state = 7;
+        for (int step = 0; step < 20000; ++step) {
+            unsigned int r = test::next_random(state);
+            if (live.empty() || r % 8 < 5) {
+                int v = static_cast<int>(r % 100000);
+                live.push_back(&*h.insert(Tracked(v)));
+                model.push_back(v);
+            } else {
+                std::size_t k = r % live.size();
+                int v = live[k]->value;
+                h.erase(h.get_iterator(live[k]));
+                live[k] = live.back();
+                live.pop_back();
+                *std::find(model.begin(), model.end(), v) = model.back();
+                model.pop_back();
+            }
+            if (step % 1000 == 0)
+                assert(matches(h, model));
+        }
+        assert(matches(h, model));
+        for (std::size_t k = 0; k < live.size(); ++k)
+            assert(h.get_iterator(live[k]) != h.end());
+
+        ft::hive<Tracked> copy(h);
+        assert(matches(copy, model));
+        ft::hive<Tracked> other;
+        other.insert(Tracked(1));
+        other = copy;
+        assert(matches(other, model));
+        other.clear();
+        assert(other.empty() && other.begin() == other.end());
+        other.swap(h);
+        assert(h.empty() && matches(other, model));
+    }
+    assert(Tracked::live == 0);
+    {
+        const int values[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+        ft::hive<int> h(values, values + 8);
+        ft::hive<int> filled(5, 7);
+        assert(h.size() == 8 && filled.size() == 5 && *filled.begin() == 7);
+        int sum = 0;
+        for (ft::hive<int>::const_iterator it = h.begin(); it != h.end(); ++it)
+            sum += *it;
+        assert(sum == 31);
+        assert(h.get_iterator(&sum) == h.end());
+    }
+    std::cout << "[ft::hive] All tests passed." << std::endl;
+}
+
+#endif
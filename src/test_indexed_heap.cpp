@@ -0,0 +1,70 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <cassert>
+#include <functional>
+#include "indexed_heap.hpp"
+#include "memory/monotonic_arena.hpp"
+#include "test_utils.hpp"
+
+void run_indexed_heap_tests() {
+    std::cout << "\n[ft::indexed_heap] Starting tests..." << std::endl;
+
+    ft::indexed_heap<int> heap;
+    assert(heap.empty());
+
+    ft::indexed_heap<int>::handle_type h[10];
+    for (int i = 0; i < 10; ++i)
+        h[i] = heap.push(i * 10);
+    assert(heap.size() == 10);
+    assert(heap.top() == 90);
+    assert(heap.top_handle() == h[9]);
+
+    // Increase-key and decrease-key
+    heap.update(h[2], 1000);
+    assert(heap.top() == 1000 && heap.top_handle() == h[2]);
+    heap.update(h[2], -5);
+    assert(heap.top() == 90);
+    assert(heap[h[2]] == -5);
+
+    // Erase from the middle
+    heap.erase(h[5]);
+    assert(!heap.contains(h[5]));
+    assert(heap.size() == 9);
+
+    bool thrown = false;
+    try {
+        heap.update(h[5], 1);
+    } catch (const ft::exception&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Pops come out in priority order
+    int prev = heap.top();
+    while (!heap.empty()) {
+        assert(heap.top() <= prev);
+        prev = heap.top();
+        heap.pop();
+    }
+
+    // Handles are recycled after removal
+    ft::indexed_heap<int, std::greater<int> > min_heap;
+    ft::indexed_heap<int, std::greater<int> >::handle_type a = min_heap.push(7);
+    min_heap.push(3);
+    min_heap.erase(a);
+    assert(min_heap.push(1) == a);
+    assert(min_heap.top() == 1);
+
+    // The handle tables allocate from the heap's resource too
+    test::counting_resource counter;
+    {
+        typedef ft::indexed_heap<int, std::less<int>, ft::arena_allocator<int> > arena_heap;
+        arena_heap on_arena(std::less<int>(), &counter);
+        on_arena.erase(on_arena.push(1));
+        assert(counter.total == 4);
+    }
+    assert(counter.live == 0);
+
+    std::cout << "[ft::indexed_heap] All tests passed.\n" << std::endl;
+}
+#endif
@@ -0,0 +1,59 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "vector.hpp"
+#include "list.hpp"
+#include "memory/mmap_allocator.hpp"
+
+namespace {
+
+// 4 KiB threshold so the mapped and mremap paths run at test sizes
+typedef ft::mmap_allocator<int, 4096> small_map_int;
+
+}
+
+void run_mmap_allocator_tests() {
+    std::cout << "\n[ft::mmap_allocator] Starting tests..." << std::endl;
+
+    // Crosses operator new -> mmap, then grows by mremap
+    ft::vector<int, small_map_int> v;
+    for (int i = 0; i < 200000; ++i) {
+        v.push_back(i);
+        assert(v[i / 2] == i / 2);
+    }
+    for (int i = 0; i < 200000; ++i)
+        assert(v[i] == i);
+
+    // Shrinks mapped -> mapped, then mapped -> operator new
+    v.resize(5000);
+    v.shrink_to_fit();
+    assert(v.capacity() == 5000 && v.back() == 4999);
+    v.resize(10);
+    v.shrink_to_fit();
+    assert(v.capacity() == 10 && v[9] == 9);
+
+    ft::vector<int, small_map_int> copy(v);
+    assert(copy == v);
+    v.reserve(100000);
+    assert(v.capacity() == 100000 && v == copy);
+
+    // Not trivially relocatable: the vector copies element by element
+    ft::vector<std::string, ft::mmap_allocator<std::string, 4096> > words;
+    for (int i = 0; i < 3000; ++i)
+        words.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+    assert(words[2999][0] == 'a' + 2999 % 26 && words[0].size() == 40);
+
+    // Node containers rebind it like any other allocator
+    ft::list<int, small_map_int> nodes;
+    for (int i = 0; i < 100; ++i)
+        nodes.push_back(i);
+    assert(nodes.size() == 100 && nodes.back() == 99);
+
+    assert(ft::allocator_reallocates<small_map_int>::value);
+    assert(!ft::allocator_reallocates<std::allocator<int> >::value);
+    assert(ft::is_trivially_relocatable<int*>::value);
+
+    std::cout << "[ft::mmap_allocator] All tests passed." << std::endl;
+}
+#endif
@@ -0,0 +1,108 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <cstddef>
+#include "vector.hpp"
+#include "list.hpp"
+#include "deque.hpp"
+#include "small_vector.hpp"
+#include "ring_buffer.hpp"
+#include "memory/monotonic_arena.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+using test::counting_resource;
+
+bool inside(const void* p, const char* buffer, std::size_t size) {
+    const char* c = static_cast<const char*>(p);
+    return c >= buffer && c < buffer + size;
+}
+
+}
+
+void run_monotonic_arena_tests() {
+    std::cout << "\n[ft::monotonic_arena] Starting tests..." << std::endl;
+
+    // Requests that fit the initial buffer never reach upstream
+    {
+        counting_resource upstream;
+        char buffer[1024];
+        ft::monotonic_arena arena(buffer, sizeof(buffer), &upstream);
+        void* a = arena.allocate(10, 1);
+        void* b = arena.allocate(8, 8);
+        assert(inside(a, buffer, sizeof(buffer)) && inside(b, buffer, sizeof(buffer)));
+        assert(reinterpret_cast<std::size_t>(b) % 8 == 0 && b != a);
+        assert(upstream.total == 0);
+
+        // Overflow chains a chunk at least as large as the request
+        void* big = arena.allocate(4000, 64);
+        assert(!inside(big, buffer, sizeof(buffer)) && reinterpret_cast<std::size_t>(big) % 64 == 0);
+        assert(upstream.live == 1);
+        arena.deallocate(big, 4000, 64);
+        assert(upstream.live == 1);
+
+        arena.release();
+        assert(upstream.live == 0);
+        assert(arena.allocate(10, 1) == a);
+    }
+
+    // Every container draws from the arena, and one release frees it all
+    {
+        counting_resource upstream;
+        char buffer[256];
+        {
+            ft::monotonic_arena arena(buffer, sizeof(buffer), &upstream);
+            for (int request = 0; request < 3; ++request) {
+                {
+                    ft::vector<int, ft::arena_allocator<int> > v(&arena);
+                    for (int i = 0; i < 1000; ++i)
+                        v.push_back(i);
+                    assert(v[999] == 999);
+
+                    ft::vector<int, ft::arena_allocator<int> > copy(v);
+                    assert(copy == v && copy.get_allocator() == v.get_allocator());
+
+                    ft::list<std::string, ft::arena_allocator<std::string> > names(&arena);
+                    for (int i = 0; i < 100; ++i)
+                        names.push_back(std::string(30, 'n'));
+                    assert(names.size() == 100 && names.front() == std::string(30, 'n'));
+
+                    ft::deque<double, ft::arena_allocator<double> > dq(300, 2.5, &arena);
+                    assert(dq[299] == 2.5);
+
+                    ft::small_vector<int, 4, ft::arena_allocator<int> > sv(&arena);
+                    for (int i = 0; i < 50; ++i)
+                        sv.push_back(i);
+                    assert(sv[49] == 49);
+
+                    ft::ring_buffer<int, ft::arena_allocator<int> > ring(64, false, &arena);
+                    ring.push_back(7);
+                    assert(ring.front() == 7);
+                }
+                assert(upstream.live > 0);
+                arena.release();
+                assert(upstream.live == 0);
+            }
+            ft::vector<int, ft::arena_allocator<int> > leftover(&arena);
+            leftover.push_back(1);
+            leftover.reserve(1000);
+        }
+        // The destructor releases what is still held
+        assert(upstream.live == 0 && upstream.total > 0);
+    }
+
+    // Default-constructed allocators use the heap resource
+    {
+        ft::vector<int, ft::arena_allocator<int> > heap;
+        heap.push_back(3);
+        assert(heap.get_allocator().resource() == ft::new_delete_resource());
+        ft::arena_allocator<int> a;
+        ft::arena_allocator<long> b(a);
+        assert(a == b);
+    }
+
+    std::cout << "[ft::monotonic_arena] All tests passed." << std::endl;
+}
+#endif
@@ -0,0 +1,135 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include "packed_vector.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+template <typename Packed>
+bool matches(const Packed& p, const std::vector<typename Packed::value_type>& model) {
+    if (!test::same_indexed(p, model) || !test::same_sequence(p, model))
+        return false;
+    std::vector<typename Packed::value_type> out(model.size() + 1);
+    if (p.copy_to(&out[0]) != &out[0] + model.size())
+        return false;
+    for (std::size_t k = 0; k < model.size(); ++k)
+        if (out[k] != model[k])
+            return false;
+    return true;
+}
+
+template <typename Packed>
+void check_widths(void (*fill)(std::vector<typename Packed::value_type>&, std::size_t)) {
+    for (std::size_t n = 0; n < 700; n += 37) {
+        std::vector<typename Packed::value_type> model;
+        fill(model, n);
+        Packed p(model.begin(), model.end());
+        assert(matches(p, model));
+    }
+}
+
+void sorted_ids(std::vector<int>& out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+        out.push_back(1000000 + static_cast<int>(i * 3 + i % 2));
+}
+
+void small_signed(std::vector<int>& out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+        out.push_back(static_cast<int>(i % 19) - 9);
+}
+
+void full_range(std::vector<long long>& out, std::size_t n) {
+    unsigned long long x = 88172645463325252ULL;
+    for (std::size_t i = 0; i < n; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        out.push_back(static_cast<long long>(x >> (i % 64)));
+    }
+}
+
+void unsigned_mix(std::vector<unsigned int>& out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+        out.push_back(i % 128 == 5 ? 4000000000u : static_cast<unsigned int>(i % 7));
+}
+
+void check_all_levels() {
+    check_widths<ft::packed_vector<int> >(sorted_ids);
+    check_widths<ft::packed_vector<int, ft::fixed_width> >(sorted_ids);
+    check_widths<ft::packed_vector<int> >(small_signed);
+    check_widths<ft::packed_vector<int, ft::fixed_width> >(small_signed);
+    check_widths<ft::packed_vector<long long> >(full_range);
+    check_widths<ft::packed_vector<long long, ft::fixed_width> >(full_range);
+    check_widths<ft::packed_vector<unsigned int, ft::fixed_width> >(unsigned_mix);
+}
+
+}
+
+void run_packed_vector_tests() {
+    std::cout << "\n[ft::packed_vector] Starting tests..." << std::endl;
+    {
+        // Block widths follow the data
+        std::vector<int> ids;
+        sorted_ids(ids, 256);
+        ft::packed_vector<int> frame(ids.begin(), ids.end());
+        ft::packed_vector<int, ft::fixed_width> fixed(ids.begin(), ids.end());
+        assert(frame.block_width(0) == 9 && fixed.block_width(0) == 21);
+        assert(frame.bytes_used() < fixed.bytes_used());
+        assert(frame.bytes_used() < ids.size() * sizeof(int) / 2);
+
+        ft::packed_vector<int> constant(ids.begin(), ids.begin());
+        for (int i = 0; i < 300; ++i)
+            constant.push_back(-7);
+        assert(constant.block_width(0) == 0 && constant.block_width(1) == 0);
+        assert(constant[299] == -7 && constant.back() == -7 && constant.front() == -7);
+
+        ft::packed_vector<int, ft::fixed_width> negative;
+        negative.push_back(-1);
+        negative.push_back(0);
+        negative.push_back(1);
+        assert(negative[0] == -1 && negative.at(2) == 1);
+
+        bool thrown = false;
+        try {
+            negative.at(3);
+        } catch (const ft::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        negative.swap(fixed);
+        assert(negative.size() == 256 && fixed.size() == 3 && fixed[0] == -1);
+        assert(matches(negative, ids));
+        frame.clear();
+        assert(frame.empty() && frame.bytes_used() == 0 && frame.begin() == frame.end());
+    }
+    {
+        // Each iterator decodes into its own buffer, so a copy stays right
+        // while the original moves on to other blocks
+        std::vector<int> ids;
+        sorted_ids(ids, 700);
+        ft::packed_vector<int> p(ids.begin(), ids.end());
+        ft::packed_vector<int>::const_iterator it = p.begin();
+        ft::packed_vector<int>::const_iterator first = it++;
+        assert(*first == ids[0] && *it == ids[1]);
+        ft::packed_vector<int>::const_iterator far = it;
+        for (int i = 1; i < 300; ++i)
+            ++far;
+        assert(*first < *far && *far == ids[300] && *it == ids[1]);
+        first = far;
+        assert(*first == ids[300] && first.index() == 300);
+
+        // reserve sizes the packed words from the blocks so far
+        std::size_t used = p.bytes_used();
+        p.reserve(2 * ids.size());
+        assert(p.bytes_used() == used);
+        for (std::size_t i = 0; i < ids.size(); ++i)
+            p.push_back(ids[i]);
+        assert(p.size() == 1400 && p[699] == ids[699] && p[1399] == ids[699]);
+    }
+    test::for_each_simd_level(check_all_levels);
+    std::cout << "[ft::packed_vector] All tests passed." << std::endl;
+}
+#endif
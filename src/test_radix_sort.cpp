@@ -0,0 +1,88 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include "vector.hpp"
+#include "algorithm.hpp"
+
+namespace {
+
+struct Cell {
+    int x, y;
+    int order;
+    Cell(int a = 0, int b = 0, int o = 0) : x(a), y(b), order(o) {}
+};
+
+// Packs (x, y) into one key ordered by x, then y
+struct CellKey {
+    typedef unsigned long long result_type;
+    unsigned long long operator()(const Cell& c) const {
+        return (static_cast<unsigned long long>(static_cast<unsigned>(c.x)) << 32) |
+               static_cast<unsigned>(c.y);
+    }
+};
+
+int cell_row(const Cell& c) { return c.x - 500; }
+
+template <typename T>
+bool is_sorted_vec(const ft::vector<T>& v) {
+    for (std::size_t i = 1; i < v.size(); ++i)
+        if (v[i] < v[i - 1])
+            return false;
+    return true;
+}
+
+}
+
+void run_radix_sort_tests() {
+    std::cout << "\n[ft::radix_sort] Starting tests..." << std::endl;
+
+    const std::size_t sizes[] = { 0, 1, 255, 256, 5000 };
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        ft::vector<int> ints;
+        ft::vector<unsigned long long> wide;
+        for (std::size_t i = 0; i < sizes[s]; ++i) {
+            ints.push_back(std::rand() - RAND_MAX / 2);
+            wide.push_back(static_cast<unsigned long long>(std::rand()) << 33);
+        }
+        ft::vector<int> ints_msd(ints);
+        ft::vector<int> ints_ref(ints);
+        ft::sort(ints_ref.begin(), ints_ref.end());
+
+        // Signed keys: negatives first
+        ft::radix_sort(ints.begin(), ints.end());
+        assert(ints == ints_ref);
+        ft::radix_sort_in_place(ints_msd.begin(), ints_msd.end());
+        assert(ints_msd == ints_ref);
+
+        // Low bytes are all zero, so those passes are skipped
+        ft::radix_sort(wide.begin(), wide.end());
+        assert(is_sorted_vec(wide));
+    }
+
+    // Projection onto a 64-bit key; the LSD sort keeps equal keys in order
+    ft::vector<Cell> cells;
+    for (int i = 0; i < 3000; ++i)
+        cells.push_back(Cell(std::rand() % 1000, std::rand() % 4, i));
+    ft::vector<Cell> in_place(cells);
+
+    ft::radix_sort(cells.begin(), cells.end(), CellKey());
+    for (std::size_t i = 1; i < cells.size(); ++i) {
+        assert(CellKey()(cells[i - 1]) <= CellKey()(cells[i]));
+        if (CellKey()(cells[i - 1]) == CellKey()(cells[i]))
+            assert(cells[i - 1].order < cells[i].order);
+    }
+
+    ft::radix_sort_in_place(in_place.begin(), in_place.end(), CellKey());
+    for (std::size_t i = 1; i < in_place.size(); ++i)
+        assert(CellKey()(in_place[i - 1]) <= CellKey()(in_place[i]));
+
+    // Function pointer key with a signed result
+    ft::radix_sort(in_place.begin(), in_place.end(), cell_row);
+    for (std::size_t i = 1; i < in_place.size(); ++i)
+        assert(in_place[i - 1].x <= in_place[i].x);
+
+    std::cout << "[ft::radix_sort] All tests passed." << std::endl;
+}
+#endif
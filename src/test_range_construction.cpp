@@ -0,0 +1,135 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <memory>
+#include <cassert>
+#include "vector.hpp"
+#include "list.hpp"
+#include "deque.hpp"
+
+namespace {
+
+// std::allocator that counts allocate calls
+template <typename T>
+struct counting_allocator : std::allocator<T> {
+    template <typename U>
+    struct rebind { typedef counting_allocator<U> other; };
+
+    static int allocations;
+
+    counting_allocator() {}
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(std::size_t n, const void* = 0) {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+template <typename T> int counting_allocator<T>::allocations = 0;
+
+}
+
+void run_range_construction_tests() {
+    std::cout << "\n[ft::range construction] Starting tests..." << std::endl;
+
+    ft::list<int> source;
+    for (int i = 0; i < 1000; ++i)
+        source.push_back(i);
+
+    // Forward ranges: one allocation, exact capacity
+    {
+        typedef counting_allocator<int> alloc;
+        ft::vector<int, alloc> v(source.begin(), source.end());
+        assert(alloc::allocations == 1 && v.size() == 1000 && v.capacity() == 1000);
+        assert(v[0] == 0 && v[999] == 999);
+
+        ft::vector<int, alloc> w(v.begin() + 10, v.end());
+        assert(alloc::allocations == 2 && w.size() == 990 && w[0] == 10);
+
+        // Fits: reuses the buffer
+        w.assign(v.begin(), v.begin() + 500);
+        assert(alloc::allocations == 2 && w.size() == 500 && w[499] == 499);
+        w.assign(source.begin(), source.end());
+        assert(w.size() == 1000 && w.capacity() == 1000 && w[999] == 999);
+
+        // Assigning a sub-range of itself
+        w.assign(w.begin() + 1, w.end());
+        assert(w.size() == 999 && w[0] == 1 && w[998] == 999);
+    }
+
+    // Input ranges still work, growing as they read
+    {
+        std::istringstream in("1 2 3 4 5 6 7 8 9 10");
+        ft::vector<int> v((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+        assert(v.size() == 10 && v[9] == 10);
+        std::istringstream again("7 8");
+        v.assign(std::istream_iterator<int>(again), std::istream_iterator<int>());
+        assert(v.size() == 2 && v[0] == 7 && v[1] == 8);
+    }
+
+    {
+        ft::vector<std::string> words(5, "w");
+        ft::vector<std::string> more(8, "m");
+        words.assign(more.begin(), more.end());
+        assert(words.size() == 8 && words[7] == "m");
+        words.assign(more.begin(), more.begin() + 2);
+        assert(words.size() == 2 && words[1] == "m");
+        words.assign(more.begin(), more.begin() + 6);
+        assert(words.size() == 6 && words[5] == "m");
+    }
+
+    // Deque: forward ranges set the map up once; push_back grows it
+    {
+        ft::deque<int> dq(source.begin(), source.end());
+        assert(dq.size() == 1000 && dq[0] == 0 && dq[999] == 999);
+
+        std::istringstream in("4 5 6");
+        ft::deque<int> streamed((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+        assert(streamed.size() == 3 && streamed.back() == 6);
+
+        ft::deque<int> grown;
+        for (int i = 0; i < 5000; ++i)
+            grown.push_back(i);
+        assert(grown.size() == 5000 && grown[4999] == 4999 && grown[64] == 64);
+
+        ft::deque<int> copy(grown);
+        assert(copy.size() == 5000 && copy[1234] == 1234);
+        copy = dq;
+        assert(copy.size() == 1000 && copy[999] == 999);
+        copy.assign(3, 7);
+        assert(copy.size() == 3 && copy[2] == 7);
+        copy.clear();
+        copy.push_back(1);
+        assert(copy.size() == 1 && copy.front() == 1);
+
+        ft::vector<std::string> labels(70, "label");
+        ft::deque<std::string> names(labels.begin(), labels.begin());
+        assert(names.empty());
+        for (int i = 0; i < 200; ++i)
+            names.push_back("n");
+        names.assign(labels.begin(), labels.end());
+        assert(names.size() == 70 && names[69] == "label");
+    }
+
+    // List: range insert links one chain
+    {
+        ft::list<int> l(3, 0);
+        ft::vector<int> v(source.begin(), source.end());
+        ft::list<int>::iterator pos = l.begin();
+        ++pos;
+        l.insert(pos, v.begin(), v.begin() + 5);
+        assert(l.size() == 8);
+        ft::list<int>::iterator it = l.begin();
+        assert(*it++ == 0 && *it++ == 0 && *it++ == 1 && *it == 2);
+        assert(l.back() == 0);
+        l.assign(v.begin(), v.end());
+        assert(l.size() == 1000 && l.back() == 999);
+    }
+
+    std::cout << "[ft::range construction] All tests passed." << std::endl;
+}
+#endif
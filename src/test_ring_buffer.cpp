@@ -0,0 +1,99 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <cassert>
+#include "ring_buffer.hpp"
+#include "test_utils.hpp"
+
+void run_ring_buffer_tests() {
+    std::cout << "\n[ft::ring_buffer] Starting tests..." << std::endl;
+
+    // Capacity is rounded up to a power of two
+    ft::ring_buffer<int> rb(5);
+    assert(rb.capacity() == 8);
+    assert(rb.empty());
+
+    for (int i = 0; i < 8; ++i)
+        rb.push_back(i);
+    assert(rb.full());
+
+    bool thrown = false;
+    try {
+        rb.push_back(8);
+    } catch (const ft::exception&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Wrap around the physical end
+    rb.pop_front();
+    rb.pop_front();
+    rb.push_back(8);
+    rb.push_front(1);
+    assert(rb.front() == 1 && rb.back() == 8);
+    assert(rb[1] == 2 && rb.at(7) == 8);
+    assert(rb.end() - rb.begin() == 8);
+
+    int expected = 8;
+    for (ft::ring_buffer<int>::reverse_iterator it = rb.rbegin(); it != rb.rend() && expected > 1; ++it)
+        assert(*it == expected--);
+
+    // Bulk pop across the wrap point
+    int out[8];
+    assert(rb.pop_front_n(out, 3) == 3);
+    assert(out[0] == 1 && out[1] == 2 && out[2] == 3);
+    assert(rb.size() == 5);
+
+    // Bulk push only takes what fits without overwrite
+    int src[] = {10, 11, 12, 13, 14};
+    assert(rb.push_back_n(src, 5) == 3);
+    assert(rb.full() && rb.back() == 12);
+
+    // Overwrite-oldest keeps the newest window
+    ft::ring_buffer<int> window(4, true);
+    for (int i = 0; i < 10; ++i)
+        window.push_back(i);
+    assert(window.size() == 4 && window.front() == 6 && window.back() == 9);
+    window.push_back_n(src, 3);
+    assert(window.front() == 9 && window.back() == 12);
+    window.push_back_n(src, 5);
+    assert(window.front() == 11 && window.back() == 14);
+
+    ft::ring_buffer<int> copy(window);
+    assert(copy == window);
+    copy.pop_back();
+    assert(copy != window);
+
+    // A copy throwing in the wrapped second run leaves nothing behind
+    {
+        ft::ring_buffer<test::Tracked> tracked(8);
+        for (int i = 0; i < 6; ++i)
+            tracked.push_back(test::Tracked(i));
+        tracked.pop_front_n(NULL, 5);
+        test::Tracked values[6] = { 10, 11, 12, 13, 14, 15 };
+        int live = test::Tracked::live;
+        test::Tracked::copy_budget = 4;
+        thrown = false;
+        try {
+            tracked.push_back_n(values, 6);
+        } catch (int) {
+            thrown = true;
+        }
+        test::Tracked::copy_budget = -1;
+        assert(thrown && test::Tracked::live == live);
+        assert(tracked.size() == 1 && tracked.front().value == 5);
+
+        tracked.push_back_n(values, 6);
+        test::Tracked::copy_budget = 3;
+        thrown = false;
+        try {
+            ft::ring_buffer<test::Tracked> copy(tracked);
+        } catch (int) {
+            thrown = true;
+        }
+        test::Tracked::copy_budget = -1;
+        assert(thrown && test::Tracked::live == live + 6);
+    }
+
+    std::cout << "[ft::ring_buffer] All tests passed.\n" << std::endl;
+}
+#endif
@@ -0,0 +1,154 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "slot_map.hpp"
+#include "memory/monotonic_arena.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+using test::Tracked;
+
+typedef ft::slot_map<std::string> names;
+
+}
+
+void run_slot_map_tests() {
+    std::cout << "\n[ft::slot_map] Starting tests..." << std::endl;
+    {
+        names m;
+        assert(m.empty() && m.begin() == m.end());
+        names::key_type a = m.insert("a");
+        names::key_type b = m.insert("b");
+        names::key_type c = m.insert("c");
+        assert(m.size() == 3 && m[a] == "a" && m[b] == "b" && m.at(c) == "c");
+
+        // Swap-and-pop: c moves into a's place, its key still finds it
+        m.erase(a);
+        assert(m.size() == 2 && !m.contains(a) && m.find(a) == m.end());
+        assert(*m.begin() == "c" && m[c] == "c" && m[b] == "b");
+        assert(m.key_of(m.begin()) == c && m.key_of(m.find(b)) == b);
+
+        bool thrown = false;
+        try {
+            m.at(a);
+        } catch (const ft::exception&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            m.erase(a);
+        } catch (const ft::exception&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        // The freed slot is reused under a new generation
+        names::key_type d = m.insert("d");
+        assert(d.index == a.index && d != a);
+        assert(!m.contains(a) && m.contains(d) && m[d] == "d");
+
+        m[d] = "dd";
+        assert(m.at(d) == "dd");
+
+        m.clear();
+        assert(m.empty() && !m.contains(b) && !m.contains(c) && !m.contains(d));
+        names::key_type e = m.insert("e");
+        assert(m.contains(e) && !m.contains(b) && !m.contains(c) && !m.contains(d));
+    }
+    {
+        // Random inserts and erases against a model of live keys
+        ft::slot_map<int> m;
+        std::vector<ft::slot_map_key> live;
+        std::vector<int> values;
+        std::vector<ft::slot_map_key> dead;
+        unsigned int state = 11;
+        for (int step = 0; step < 20000; ++step) {
+            unsigned int r = test::next_random(state);
+            if (live.empty() || r % 8 < 5) {
+                int v = static_cast<int>(r);
+                live.push_back(m.insert(v));
+                values.push_back(v);
+            } else {
+                std::size_t k = r % live.size();
+                m.erase(live[k]);
+                dead.push_back(live[k]);
+                live[k] = live.back();
+                live.pop_back();
+                values[k] = values.back();
+                values.pop_back();
+            }
+        }
+        assert(m.size() == live.size());
+        for (std::size_t k = 0; k < live.size(); ++k)
+            assert(m.contains(live[k]) && m[live[k]] == values[k]);
+        for (std::size_t k = 0; k < dead.size(); ++k)
+            assert(!m.contains(dead[k]));
+
+        // The dense range holds exactly the live values
+        long long dense = 0;
+        long long expected = 0;
+        for (ft::slot_map<int>::const_iterator it = m.begin(); it != m.end(); ++it) {
+            assert(m[m.key_of(it)] == *it);
+            dense += *it;
+        }
+        for (std::size_t k = 0; k < values.size(); ++k)
+            expected += values[k];
+        assert(dense == expected);
+
+        ft::slot_map<int> other;
+        other.swap(m);
+        assert(m.empty() && other.size() == live.size() && other.contains(live[0]));
+    }
+    {
+        // Forged keys, including a zero key, never match a free slot
+        ft::slot_map<Tracked> m;
+        ft::slot_map_key zero = { 0, 0 };
+        Tracked::copy_budget = 0;
+        bool thrown = false;
+        try {
+            m.insert(Tracked(1));
+        } catch (int) {
+            thrown = true;
+        }
+        Tracked::copy_budget = -1;
+        assert(thrown && m.empty() && !m.contains(zero) && m.find(zero) == m.end());
+        thrown = false;
+        try {
+            m.at(zero);
+        } catch (const ft::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        ft::slot_map_key a = m.insert(Tracked(2));
+        assert(a.index == 0 && a.generation == 1 && m.size() == 1);
+        m.erase(a);
+        ft::slot_map_key forged = { a.index, a.generation + 1 };
+        assert(!m.contains(forged) && m.find(forged) == m.end());
+        thrown = false;
+        try {
+            m.erase(forged);
+        } catch (const ft::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown && m.empty());
+    }
+    assert(Tracked::live == 0);
+    {
+        // The index vectors allocate from the map's resource too
+        test::counting_resource counter;
+        {
+            ft::slot_map<int, ft::arena_allocator<int> > m(&counter);
+            m.insert(1);
+            assert(counter.total == 3);
+        }
+        assert(counter.live == 0);
+    }
+    std::cout << "[ft::slot_map] All tests passed." << std::endl;
+}
+
+#endif
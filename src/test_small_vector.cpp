@@ -0,0 +1,210 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "small_vector.hpp"
+#include "vector.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+using test::Tracked;
+
+typedef ft::small_vector<Tracked, 4> small;
+
+small make(int first, int count) {
+    small v;
+    for (int i = 0; i < count; ++i)
+        v.push_back(Tracked(first + i));
+    return v;
+}
+
+bool holds(const small& v, int first, int count) {
+    if (static_cast<int>(v.size()) != count)
+        return false;
+    for (int i = 0; i < count; ++i)
+        if (v[i].value != first + i)
+            return false;
+    return true;
+}
+
+}
+
+void run_small_vector_tests() {
+    std::cout << "\n[ft::small_vector] Starting tests..." << std::endl;
+    {
+        small v;
+        assert(v.is_inline() && v.capacity() == 4 && v.empty());
+        for (int i = 0; i < 4; ++i)
+            v.push_back(Tracked(i));
+        assert(v.is_inline());
+        v.push_back(Tracked(4));
+        assert(!v.is_inline() && v.capacity() >= 5);
+        assert(holds(v, 0, 5));
+
+        // Pushing an element of the vector while it reallocates
+        small w = make(0, 4);
+        w.push_back(w[0]);
+        assert(w[4].value == 0);
+
+        v.erase(v.begin() + 1, v.begin() + 4);
+        assert(v.size() == 2 && v[0].value == 0 && v[1].value == 4);
+        v.shrink_to_fit();
+        assert(v.is_inline() && v.capacity() == 4);
+        assert(v[0].value == 0 && v[1].value == 4);
+
+        v.insert(v.begin() + 1, 3, Tracked(7));
+        v.insert(v.begin(), v.begin() + 1, v.begin() + 3);
+        assert(v.size() == 7 && v[0].value == 7 && v[2].value == 0 && v.back().value == 4);
+        assert(v.remove(Tracked(7)) == 5);
+        assert(v.size() == 2);
+    }
+    assert(Tracked::live == 0);
+
+    // Swap in every combination of inline and heap states, both ways round
+    const int sizes[] = { 0, 2, 4, 6, 9 };
+    for (int a = 0; a < 5; ++a) {
+        for (int b = 0; b < 5; ++b) {
+            small x = make(100, sizes[a]);
+            small y = make(200, sizes[b]);
+            x.swap(y);
+            assert(holds(x, 200, sizes[b]) && holds(y, 100, sizes[a]));
+            assert(x.is_inline() == (sizes[b] <= 4) && y.is_inline() == (sizes[a] <= 4));
+            ft::swap(x, y);
+            assert(holds(x, 100, sizes[a]) && holds(y, 200, sizes[b]));
+
+            small copy(x);
+            assert(copy == x && copy.is_inline() == (sizes[a] <= 4));
+            copy = y;
+            assert(copy == y);
+            assert(!(x < x) && (x < y) == (sizes[b] > 0));
+        }
+    }
+    assert(Tracked::live == 0);
+
+    // A copy that throws while growing leaves the vector as it was
+    for (int budget = 0; budget < 7; ++budget) {
+        small v = make(0, 4);
+        int live = Tracked::live;
+        Tracked::copy_budget = budget;
+        bool thrown = false;
+        try {
+            if (budget < 4)
+                v.reserve(8);
+            else
+                v.insert(v.begin() + 2, 2, Tracked(7));
+        } catch (int) {
+            thrown = true;
+        }
+        Tracked::copy_budget = -1;
+        assert(thrown && Tracked::live == live);
+        assert(v.is_inline() && holds(v, 0, 4));
+    }
+
+    // In place, past the old end and within it
+    {
+        small v = make(0, 3);
+        Tracked::copy_budget = 1;
+        bool thrown = false;
+        try {
+            v.insert(v.begin(), Tracked(9));
+        } catch (int) {
+            thrown = true;
+        }
+        Tracked::copy_budget = -1;
+        assert(thrown && holds(v, 0, 3));
+
+        small w = make(0, 1);
+        Tracked::copy_budget = 2;
+        thrown = false;
+        try {
+            w.insert(w.begin(), 2, Tracked(9));
+        } catch (int) {
+            thrown = true;
+        }
+        Tracked::copy_budget = -1;
+        assert(thrown && holds(w, 0, 1));
+        w.insert(w.begin(), 2, Tracked(9));
+        assert(w.size() == 3 && w[0].value == 9 && w[1].value == 9 && w[2].value == 0);
+    }
+    assert(Tracked::live == 0);
+
+    // Constructors that throw part way leak neither elements nor blocks
+    {
+        small heap = make(0, 6);
+        Tracked seven(7);
+        int live = Tracked::live;
+        for (int budget = 0; budget < 10; ++budget) {
+            for (int kind = 0; kind < 3; ++kind) {
+                Tracked::copy_budget = budget;
+                try {
+                    if (kind == 0)
+                        small copy(heap);
+                    else if (kind == 1)
+                        small filled(6, seven);
+                    else
+                        small range(heap.begin(), heap.end());
+                } catch (int) {
+                }
+                Tracked::copy_budget = -1;
+                assert(Tracked::live == live);
+            }
+        }
+    }
+    assert(Tracked::live == 0);
+
+    // A copy that throws while a swap relocates elements changes nothing
+    for (int budget = 0; budget < 2; ++budget) {
+        small two = make(10, 2);
+        small four = make(20, 4);
+        small heap = make(0, 6);
+        Tracked::copy_budget = budget;
+        int thrown = 0;
+        try {
+            two.swap(four);
+        } catch (int) {
+            ++thrown;
+        }
+        try {
+            heap.swap(two);
+        } catch (int) {
+            ++thrown;
+        }
+        Tracked::copy_budget = -1;
+        assert(thrown == 2 && holds(two, 10, 2) && holds(four, 20, 4) && holds(heap, 0, 6));
+        assert(two.is_inline() && !heap.is_inline());
+    }
+    assert(Tracked::live == 0);
+
+    // Same interface as ft::vector
+    ft::small_vector<int, 8> ints(3, 5);
+    ft::vector<int> ref(3, 5);
+    for (int i = 0; i < 20; ++i) {
+        ints.push_back(i % 3);
+        ref.push_back(i % 3);
+    }
+    ints.resize(10);
+    ref.resize(10);
+    ints.insert(ints.begin() + 2, 42);
+    ref.insert(ref.begin() + 2, 42);
+    assert(ints.size() == ref.size());
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        assert(ints.at(i) == ref.at(i));
+    assert(ints.unique() == ref.unique());
+
+    try {
+        ints.at(100);
+        assert(false);
+    } catch (const ft::out_of_range&) {
+    }
+
+    ft::small_vector<std::string, 2> words;
+    words.assign(3, std::string("abc"));
+    assert(!words.is_inline() && words.front() == "abc");
+    words.clear();
+    words.shrink_to_fit();
+    assert(words.is_inline());
+
+    std::cout << "[ft::small_vector] All tests passed." << std::endl;
+}
+#endif
@@ -0,0 +1,135 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <vector>
+#include "soa_vector.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+struct Particle {
+    int x;
+    double mass;
+    std::string tag;
+
+    Particle(int x = 0, double mass = 0.0, const std::string& tag = "")
+        : x(x), mass(mass), tag(tag) {}
+
+    bool operator==(const Particle& other) const {
+        return x == other.x && mass == other.mass && tag == other.tag;
+    }
+};
+
+}
+
+namespace ft {
+
+template <>
+struct soa_traits<Particle> {
+    typedef soa_fields<soa_field<Particle, int, &Particle::x>,
+                       soa_field<Particle, double, &Particle::mass>,
+                       soa_field<Particle, std::string, &Particle::tag> > fields;
+};
+
+}
+
+namespace {
+
+typedef ft::soa_vector<Particle> particles;
+
+// Every row matches the model, read whole and field by field
+bool matches(particles& v, const std::vector<Particle>& model) {
+    if (!test::same_indexed(v, model))
+        return false;
+    ft::field_span<int> xs = v.field<0>();
+    ft::field_span<std::string> tags = v.field<2>();
+    for (std::size_t i = 0; i < model.size(); ++i)
+        if (xs[i] != model[i].x || tags[i] != model[i].tag || v[i].get<1>() != model[i].mass)
+            return false;
+    return true;
+}
+
+}
+
+void run_soa_vector_tests() {
+    std::cout << "\n[ft::soa_vector] Starting tests..." << std::endl;
+    assert(particles::field_count == 3);
+    {
+        particles v;
+        std::vector<Particle> model;
+        for (int i = 0; i < 100; ++i) {
+            Particle p(i * 7 % 31, i * 0.5, std::string(i % 5 + 1, 'a' + i % 26));
+            v.push_back(p);
+            model.push_back(p);
+        }
+        assert(matches(v, model));
+
+        v.insert(0, Particle(-1, 1.0, "first"));
+        model.insert(model.begin(), Particle(-1, 1.0, "first"));
+        v.insert(50, v[10]);
+        model.insert(model.begin() + 50, model[10]);
+        v.insert(v.size(), Particle(99, 2.0, "last"));
+        model.push_back(Particle(99, 2.0, "last"));
+        assert(matches(v, model));
+
+        v.erase(3);
+        model.erase(model.begin() + 3);
+        v.erase(20, 40);
+        model.erase(model.begin() + 20, model.begin() + 40);
+        v.pop_back();
+        model.pop_back();
+        assert(matches(v, model));
+
+        // Proxies write through to every column
+        v[5] = Particle(1000, 3.5, "set");
+        model[5] = Particle(1000, 3.5, "set");
+        v[6].get<0>() += 1;
+        model[6].x += 1;
+        v[7] = v[5];
+        model[7] = model[5];
+        assert(matches(v, model));
+
+        particles copy(v);
+        assert(copy == v);
+        copy.back().get<2>() = "changed";
+        assert(copy != v);
+
+        // Stable by x: equal keys keep their relative order
+        v.sort_by<0>();
+        for (std::size_t i = 1; i < v.size(); ++i)
+            assert(v.field<0>()[i - 1] <= v.field<0>()[i]);
+        std::vector<Particle> sorted(model);
+        for (std::size_t i = 1; i < sorted.size(); ++i)
+            for (std::size_t j = i; j > 0 && sorted[j].x < sorted[j - 1].x; --j)
+                std::swap(sorted[j], sorted[j - 1]);
+        assert(matches(v, sorted));
+
+        v.resize(3);
+        assert(v.size() == 3);
+        v.resize(5, Particle(4, 4.0, "pad"));
+        assert(Particle(v[4]) == Particle(4, 4.0, "pad"));
+        v.shrink_to_fit();
+        assert(v.capacity() == 5);
+        v.clear();
+        assert(v.empty() && v.field<1>().empty());
+    }
+    {
+        const particles v(4, Particle(2, 1.5, "c"));
+        double total = 0;
+        ft::field_span<const double> masses = v.field<1>();
+        for (const double* m = masses.begin(); m != masses.end(); ++m)
+            total += *m;
+        assert(total == 6.0 && v.at(3) == Particle(2, 1.5, "c"));
+
+        bool thrown = false;
+        try {
+            v.at(4);
+        } catch (const ft::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::cout << "[ft::soa_vector] All tests passed." << std::endl;
+}
+#endif
@@ -0,0 +1,85 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "static_vector.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+using test::Tracked;
+
+bool is_even(int x) { return x % 2 == 0; }
+
+template <typename Vec>
+bool overflows(Vec& v) {
+    try {
+        v.push_back(typename Vec::value_type());
+    } catch (const ft::exception&) {
+        return true;
+    }
+    return false;
+}
+
+}
+
+void run_static_vector_tests() {
+    std::cout << "\n[ft::static_vector] Starting tests..." << std::endl;
+    {
+        ft::static_vector<int, 6> v;
+        assert(v.empty() && v.capacity() == 6 && v.max_size() == 6);
+        for (int i = 0; i < 6; ++i)
+            v.push_back(i);
+        assert(v.full());
+        assert(overflows(v) && v.size() == 6);
+
+        assert(v.erase_if(is_even) == 3);
+        v.insert(v.begin(), 2, 9);
+        v.insert(v.end(), v.begin(), v.begin() + 1);
+        assert(v.size() == 6 && v[0] == 9 && v[2] == 1 && v.back() == 9);
+        assert(v.remove(9) == 3 && v.size() == 3);
+
+        ft::static_vector<int, 6> copy(v);
+        assert(copy == v && !(copy < v));
+        copy.back() = 100;
+        assert(v < copy && copy.data() != v.data());
+
+        try {
+            v.resize(7);
+            assert(false);
+        } catch (const ft::length_error&) {
+        }
+        try {
+            v.at(3);
+            assert(false);
+        } catch (const ft::out_of_range&) {
+        }
+    }
+    {
+        ft::static_vector<Tracked, 5> a(3, Tracked(1));
+        ft::static_vector<Tracked, 5> b;
+        b.push_back(Tracked(2));
+        assert(Tracked::live == 4);
+        a.swap(b);
+        assert(a.size() == 1 && b.size() == 3 && a[0].value == 2 && b[2].value == 1);
+        assert(Tracked::live == 4);
+        b = a;
+        assert(b.size() == 1 && b[0].value == 2 && Tracked::live == 2);
+        ft::static_vector<Tracked, 5> c(b);
+        c.resize(5, Tracked(3));
+        assert(overflows(c));
+        c.erase(c.begin() + 1, c.begin() + 4);
+        assert(c.size() == 2 && c[1].value == 3 && Tracked::live == 4);
+    }
+    assert(Tracked::live == 0);
+
+    ft::static_vector<std::string, 3> words;
+    words.assign(2, "ab");
+    words.push_back(words[0]);
+    assert(words.unique() == 2 && words.size() == 1);
+    words.clear();
+    assert(words.empty());
+
+    std::cout << "[ft::static_vector] All tests passed." << std::endl;
+}
+#endif
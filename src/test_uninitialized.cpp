@@ -0,0 +1,136 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <memory>
+#include <cassert>
+#include "vector.hpp"
+#include "deque.hpp"
+#include "utils/uninitialized.hpp"
+
+namespace {
+
+// std::allocator that counts construct and destroy calls
+template <typename T>
+struct tracing_allocator : std::allocator<T> {
+    template <typename U>
+    struct rebind { typedef tracing_allocator<U> other; };
+
+    static int constructed;
+    static int destroyed;
+
+    tracing_allocator() {}
+    template <typename U>
+    tracing_allocator(const tracing_allocator<U>&) {}
+
+    void construct(T* p, const T& val) {
+        ++constructed;
+        std::allocator<T>::construct(p, val);
+    }
+    void destroy(T* p) {
+        ++destroyed;
+        std::allocator<T>::destroy(p);
+    }
+};
+
+template <typename T> int tracing_allocator<T>::constructed = 0;
+template <typename T> int tracing_allocator<T>::destroyed = 0;
+
+// Throws from its copy constructor once the budget runs out
+struct fragile {
+    static int budget;
+    static int live;
+    int value;
+
+    fragile(int v = 0) : value(v) { ++live; }
+    fragile(const fragile& x) : value(x.value) {
+        if (budget-- == 0)
+            throw 42;
+        ++live;
+    }
+    ~fragile() { --live; }
+};
+
+int fragile::budget = -1;
+int fragile::live = 0;
+
+}
+
+void run_uninitialized_tests() {
+    std::cout << "\n[ft::uninitialized] Starting tests..." << std::endl;
+
+    std::allocator<int> ints;
+    int* buf = ints.allocate(100);
+    int src[100];
+    for (int i = 0; i < 100; ++i)
+        src[i] = i * 3;
+    assert(ft::uninitialized_copy(src, src + 100, buf, ints) == buf + 100);
+    assert(buf[0] == 0 && buf[99] == 297);
+    ft::uninitialized_fill_n(buf, 100, 0, ints);
+    assert(buf[0] == 0 && buf[99] == 0);
+    ft::uninitialized_fill_n(buf, 50, -1, ints);
+    ft::uninitialized_fill_n(buf + 50, 50, 257, ints);
+    assert(buf[49] == -1 && buf[50] == 257 && buf[99] == 257);
+    ints.deallocate(buf, 100);
+
+    std::allocator<char> chars;
+    char* text = chars.allocate(8);
+    ft::uninitialized_fill_n(text, 8, 'z', chars);
+    assert(text[0] == 'z' && text[7] == 'z');
+    chars.deallocate(text, 8);
+
+    // A throwing copy leaves nothing constructed behind
+    std::allocator<fragile> fragiles;
+    fragile* f = fragiles.allocate(10);
+    {
+        fragile one[10];
+        fragile::budget = 6;
+        bool thrown = false;
+        try {
+            ft::uninitialized_copy(one, one + 10, f, fragiles);
+        } catch (int) {
+            thrown = true;
+        }
+        assert(thrown && fragile::live == 10);
+        fragile::budget = 3;
+        thrown = false;
+        try {
+            ft::uninitialized_fill_n(f, 10, one[0], fragiles);
+        } catch (int) {
+            thrown = true;
+        }
+        assert(thrown && fragile::live == 10);
+        fragile::budget = -1;
+    }
+    fragiles.deallocate(f, 10);
+
+    // Trivial elements skip construct and destroy entirely
+    {
+        typedef tracing_allocator<int> alloc;
+        ft::vector<int, alloc> v(1000, 7);
+        ft::vector<int, alloc> copy(v);
+        v.resize(2000, 8);
+        v.resize(10);
+        v.clear();
+        assert(copy[999] == 7 && v.empty());
+        assert(alloc::constructed == 0 && alloc::destroyed == 0);
+    }
+    {
+        typedef tracing_allocator<std::string> alloc;
+        ft::vector<std::string, alloc> v(10, "x");
+        v.reserve(100);
+        assert(v[9] == "x");
+        v.clear();
+        assert(alloc::constructed == alloc::destroyed && alloc::destroyed >= 10);
+    }
+
+    // Deque fill constructor spans several blocks
+    ft::deque<int> dq(200, 9);
+    assert(dq.size() == 200 && dq[0] == 9 && dq[199] == 9);
+    dq.push_back(10);
+    assert(dq.back() == 10 && dq.size() == 201);
+    ft::deque<std::string> words(130, "word");
+    assert(words.size() == 130 && words[129] == "word");
+
+    std::cout << "[ft::uninitialized] All tests passed." << std::endl;
+}
+#endif
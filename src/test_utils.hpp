@@ -0,0 +1,119 @@
+// Helpers shared by the ft-only container tests.
+
+#ifndef TEST_UTILS_HPP
+#define TEST_UTILS_HPP
+
+#include <vector>
+#include <algorithm>
+#include "utils/simd.hpp"
+#include "memory/memory_resource.hpp"
+
+namespace test {
+
+// A template so the counters can be defined here, in the header
+template <typename Tag>
+struct tracked_counters {
+    static int live;
+    static int copy_budget;
+};
+
+template <typename Tag>
+int tracked_counters<Tag>::live = 0;
+
+template <typename Tag>
+int tracked_counters<Tag>::copy_budget = -1;
+
+// Counts live instances so relocations that leak or double-destroy show
+// up. Once copy_budget is set, copies beyond it throw, to drive the
+// containers' rollback paths; -1 allows any number.
+struct Tracked : tracked_counters<Tracked> {
+    int value;
+
+    Tracked(int v = 0) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) {
+        if (copy_budget == 0)
+            throw 42;
+        if (copy_budget > 0)
+            --copy_budget;
+        ++live;
+    }
+    ~Tracked() { --live; }
+    Tracked& operator=(const Tracked& other) {
+        value = other.value;
+        return *this;
+    }
+    bool operator==(const Tracked& other) const { return value == other.value; }
+    bool operator<(const Tracked& other) const { return value < other.value; }
+};
+
+// Resource that counts the blocks taken from and given back to it
+class counting_resource : public ft::memory_resource {
+public:
+    std::size_t live;
+    std::size_t total;
+
+    counting_resource() : live(0), total(0) {}
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t align) {
+        ++live;
+        ++total;
+        return ft::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) {
+        --live;
+        ft::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const ft::memory_resource& other) const { return this == &other; }
+};
+
+// Deterministic LCG, so a failing random sequence can be replayed
+inline unsigned int next_random(unsigned int& state) {
+    state = state * 1103515245u + 12345u;
+    return state >> 8;
+}
+
+// Runs check at every SIMD level, then lifts the cap again
+inline void for_each_simd_level(void (*check)()) {
+    for (int level = ft::SIMD_SCALAR; level <= ft::SIMD_AVX2; ++level) {
+        ft::set_simd_level(level);
+        check();
+    }
+    ft::set_simd_level(ft::SIMD_AVX2);
+}
+
+// seq[i] equals model[i] for every i
+template <typename Seq, typename T>
+bool same_indexed(Seq& seq, const std::vector<T>& model) {
+    if (seq.size() != model.size())
+        return false;
+    for (std::size_t i = 0; i < model.size(); ++i)
+        if (!(T(seq[i]) == model[i]))
+            return false;
+    return true;
+}
+
+// Walking seq from begin() to end() yields model, in order
+template <typename Seq, typename T>
+bool same_sequence(Seq& seq, const std::vector<T>& model) {
+    std::size_t i = 0;
+    for (typename Seq::const_iterator it = seq.begin(); it != seq.end(); ++it, ++i)
+        if (i == model.size() || !(*it == model[i]))
+            return false;
+    return i == model.size();
+}
+
+// seq holds the same elements as model, in any order
+template <typename Seq, typename T>
+bool same_elements(Seq& seq, const std::vector<T>& model) {
+    typedef typename Seq::value_type value_type;
+    std::vector<value_type> got(seq.begin(), seq.end());
+    std::vector<value_type> want(model.begin(), model.end());
+    std::sort(got.begin(), got.end());
+    std::sort(want.begin(), want.end());
+    return got == want;
+}
+
+} // namespace test
+
+#endif
@@ -0,0 +1,112 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "vector.hpp"
+
+namespace {
+
+struct IsOdd {
+    bool operator()(int x) const { return x & 1; }
+};
+
+struct IsShort {
+    bool operator()(const std::string& s) const { return s.size() < 3; }
+};
+
+bool is_negative(double x) { return x < 0; }
+
+// Compares against std::remove / std::unique on a copy; lengths cross the
+// 8-lane AVX2 blocks, both at every supported SIMD level
+template <typename T>
+void check_against_std(const std::vector<T>& input, const T& value) {
+    for (int level = ft::SIMD_SCALAR; level <= ft::SIMD_AVX2; ++level) {
+        ft::set_simd_level(level);
+
+        ft::vector<T> removed(input.begin(), input.end());
+        std::vector<T> expected(input);
+        expected.erase(std::remove(expected.begin(), expected.end(), value), expected.end());
+        assert(removed.remove(value) == input.size() - expected.size());
+        assert(removed.size() == expected.size());
+        assert(std::equal(expected.begin(), expected.end(), removed.begin()));
+
+        ft::vector<T> uniq(input.begin(), input.end());
+        expected = input;
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+        assert(uniq.unique() == input.size() - expected.size());
+        assert(uniq.size() == expected.size());
+        assert(std::equal(expected.begin(), expected.end(), uniq.begin()));
+    }
+    ft::set_simd_level(ft::SIMD_AVX2);
+}
+
+}
+
+void run_vector_filter_tests() {
+    std::cout << "\n[ft::vector::erase_if] Starting tests..." << std::endl;
+
+    for (std::size_t n = 0; n < 70; ++n) {
+        std::vector<int> ints;
+        std::vector<long long> wide;
+        std::vector<float> reals;
+        std::vector<short> narrow;
+        for (std::size_t i = 0; i < n; ++i) {
+            ints.push_back(std::rand() % 3);
+            wide.push_back(std::rand() % 2 ? -1LL : 1LL << 40);
+            reals.push_back(static_cast<float>(std::rand() % 3) - 1.0f);
+            narrow.push_back(static_cast<short>(std::rand() % 2));
+        }
+        check_against_std(ints, 1);
+        check_against_std(wide, -1LL);
+        check_against_std(reals, 0.0f);
+        check_against_std(narrow, static_cast<short>(0));
+
+        ft::vector<int> odd(ints.begin(), ints.end());
+        std::size_t odd_count = std::count_if(ints.begin(), ints.end(), IsOdd());
+        assert(odd.erase_if(IsOdd()) == odd_count);
+        for (std::size_t i = 0; i < odd.size(); ++i)
+            assert(!(odd[i] & 1));
+    }
+
+    // The value may be an element of the vector itself
+    ft::vector<int> self;
+    for (int i = 0; i < 20; ++i)
+        self.push_back(i % 4);
+    assert(self.remove(self[1]) == 5);
+    assert(self.size() == 15 && self[0] == 0 && self[1] == 2);
+
+    // -0.0 equals 0.0; NaN equals nothing, so it is neither removed nor merged
+    ft::vector<double> reals;
+    reals.push_back(0.0);
+    reals.push_back(-0.0);
+    reals.push_back(-2.5);
+    double nan = 0.0 / std::atof("0");
+    reals.push_back(nan);
+    reals.push_back(nan);
+    assert(reals.unique() == 1);
+    assert(reals.remove(0.0) == 1);
+    assert(reals.size() == 3);
+    assert(reals.erase_if(is_negative) == 1);
+    assert(reals.size() == 2 && reals[0] != reals[0]);
+
+    // Non-arithmetic elements take the generic path
+    ft::vector<std::string> words;
+    const char* raw[] = { "ab", "abc", "abc", "a", "abcd", "abcd", "abcd", "xy" };
+    for (std::size_t i = 0; i < sizeof(raw) / sizeof(raw[0]); ++i)
+        words.push_back(raw[i]);
+    assert(words.unique() == 3);
+    assert(words.size() == 5);
+    assert(words.erase_if(IsShort()) == 3);
+    assert(words.size() == 2 && words[0] == "abc" && words[1] == "abcd");
+    assert(words.remove("abc") == 1);
+    assert(words.size() == 1 && words.front() == "abcd");
+
+    ft::vector<int> empty;
+    assert(empty.unique() == 0 && empty.remove(3) == 0 && empty.erase_if(IsOdd()) == 0);
+
+    std::cout << "[ft::vector::erase_if] All tests passed." << std::endl;
+}
+#endif
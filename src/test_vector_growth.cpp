@@ -0,0 +1,105 @@
+#ifdef MODE_FT
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "vector.hpp"
+#include "utils/growth_policy.hpp"
+#include "memory/monotonic_arena.hpp"
+#include "test_utils.hpp"
+
+namespace {
+
+// Pushes n elements and checks every reallocation against the policy
+template <typename T, typename Growth>
+void check_growth(std::size_t n) {
+    ft::vector<T, std::allocator<T>, Growth> v;
+    std::size_t previous = v.capacity();
+    std::size_t reallocations = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        v.push_back(T());
+        if (v.capacity() != previous) {
+            assert(v.capacity() == Growth::next_capacity(previous, i + 1, v.max_size(), sizeof(T)));
+            previous = v.capacity();
+            ++reallocations;
+        }
+        assert(v.capacity() >= v.size());
+    }
+    assert(reallocations < 64);
+
+    // Copies do not inherit spare capacity
+    ft::vector<T, std::allocator<T>, Growth> copy(v);
+    assert(copy.capacity() == copy.size() && copy.size() == n);
+
+    v.resize(n / 2);
+    v.shrink_to_fit();
+    assert(v.capacity() == n / 2 && v.size() == n / 2);
+    v.clear();
+    v.shrink_to_fit();
+    assert(v.capacity() == 0);
+    v.push_back(T());
+    assert(v.size() == 1);
+}
+
+}
+
+void run_vector_growth_tests() {
+    std::cout << "\n[ft::vector growth] Starting tests..." << std::endl;
+
+    assert(ft::growth_doubling::next_capacity(0, 1, 100, 4) == 1);
+    assert(ft::growth_doubling::next_capacity(8, 9, 100, 4) == 16);
+    assert(ft::growth_doubling::next_capacity(60, 61, 100, 4) == 100);
+    assert(ft::growth_one_and_half::next_capacity(1, 2, 100, 4) == 2);
+    assert(ft::growth_one_and_half::next_capacity(10, 11, 100, 4) == 15);
+    assert(ft::growth_one_and_half::next_capacity(10, 40, 100, 4) == 40);
+
+    // jemalloc classes: 16-byte steps to 128, then four per power of two
+    assert(ft::growth_size_class::size_class(1) == 16);
+    assert(ft::growth_size_class::size_class(120) == 128);
+    assert(ft::growth_size_class::size_class(129) == 160);
+    assert(ft::growth_size_class::size_class(256) == 256);
+    assert(ft::growth_size_class::size_class(257) == 320);
+    assert(ft::growth_size_class::size_class(5000) == 5120);
+    // 1.5 * 10 ints = 60 bytes -> 64 bytes -> 16 ints
+    assert(ft::growth_size_class::next_capacity(10, 11, 1000, 4) == 16);
+    assert(ft::growth_size_class::next_capacity(10, 11, 12, 4) == 12);
+
+    check_growth<int, ft::growth_doubling>(1000);
+    check_growth<int, ft::growth_one_and_half>(1000);
+    check_growth<int, ft::growth_size_class>(1000);
+    check_growth<std::string, ft::growth_size_class>(300);
+
+    ft::vector<int, std::allocator<int>, ft::growth_size_class> a(3, 1);
+    ft::vector<int, std::allocator<int>, ft::growth_size_class> b(a);
+    assert(a == b && !(a < b));
+    b.push_back(2);
+    ft::swap(a, b);
+    assert(a.size() == 4 && b < a);
+
+    {
+        // A copy that throws inside a constructor gives the block back
+        typedef ft::vector<test::Tracked, ft::arena_allocator<test::Tracked> > tracked_vector;
+        test::counting_resource counter;
+        test::Tracked one(1);
+        tracked_vector src(5, one, &counter);
+        for (int budget = 0; budget < 5; ++budget) {
+            for (int kind = 0; kind < 2; ++kind) {
+                test::Tracked::copy_budget = budget;
+                bool thrown = false;
+                try {
+                    if (kind == 0)
+                        tracked_vector copy(src);
+                    else
+                        tracked_vector filled(5, one, &counter);
+                } catch (int) {
+                    thrown = true;
+                }
+                test::Tracked::copy_budget = -1;
+                assert(thrown && counter.live == 1 && test::Tracked::live == 6);
+            }
+        }
+    }
+    assert(test::Tracked::live == 0);
+
+    std::cout << "[ft::vector growth] All tests passed." << std::endl;
+}
+#endif